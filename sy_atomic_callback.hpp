@@ -0,0 +1,210 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_ATOMIC_CALLBACK_HPP
+#define SY_ATOMIC_CALLBACK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include "sy_callback.hpp"
+
+namespace sy_callback {
+    // epoch based reclamation shared by every atomic_callback of the process:
+    // a reader publishes the global epoch in its thread record while it holds a node,
+    // a node retired at epoch E is destroyed once no record holds an epoch <= E
+    class epoch_domain {
+    public:
+        // padded rather than alignas(64): over-aligned new needs C++17
+        struct record {
+            std::atomic<std::uint64_t> epoch;
+            std::atomic<bool> in_use;
+            record* next;
+            unsigned nesting;
+            char padding[64];
+
+            record() : epoch(0), in_use(true), next(nullptr), nesting(0) {}
+        };
+
+        class guard {
+            record* _record;
+        public:
+            guard() : _record(epoch_domain::local()) {
+                if (_record->nesting++ == 0)
+                    _record->epoch.store(epoch_domain::instance()._epoch.load(std::memory_order_acquire),
+                                         std::memory_order_seq_cst);
+            }
+            ~guard() {
+                if (--_record->nesting == 0) _record->epoch.store(0, std::memory_order_release);
+            }
+            guard(const guard&) = delete;
+            guard& operator=(const guard&) = delete;
+        };
+
+        static epoch_domain& instance() {
+            static epoch_domain domain;
+            return domain;
+        }
+
+        // returns the epoch a node unlinked before this call is retired at
+        std::uint64_t advance() { return _epoch.fetch_add(1, std::memory_order_seq_cst); }
+
+        bool is_quiescent(std::uint64_t retired) const {
+            for (record* r = _head.load(std::memory_order_acquire); r; r = r->next) {
+                std::uint64_t epoch = r->epoch.load(std::memory_order_seq_cst);
+                if (epoch != 0 && epoch <= retired) return false;
+            }
+            return true;
+        }
+
+    private:
+        std::atomic<std::uint64_t> _epoch;
+        std::atomic<record*> _head;
+
+        epoch_domain() : _epoch(1), _head(nullptr) {}
+        ~epoch_domain() {
+            record* r = _head.load(std::memory_order_relaxed);
+            while (r) {
+                record* next = r->next;
+                delete r;
+                r = next;
+            }
+        }
+
+        struct holder {
+            record* _record;
+            holder() : _record(epoch_domain::instance().acquire()) {}
+            ~holder() {
+                _record->epoch.store(0, std::memory_order_release);
+                _record->in_use.store(false, std::memory_order_release);
+            }
+        };
+
+        static record* local() {
+            static thread_local holder local_holder;
+            return local_holder._record;
+        }
+
+        // records are never freed while the process runs, a thread that exits leaves its record for the next one
+        record* acquire() {
+            for (record* r = _head.load(std::memory_order_acquire); r; r = r->next) {
+                bool expected = false;
+                if (!r->in_use.load(std::memory_order_relaxed) &&
+                    r->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) return r;
+            }
+            record* r = new record();
+            r->next = _head.load(std::memory_order_relaxed);
+            while (!_head.compare_exchange_weak(r->next, r, std::memory_order_release, std::memory_order_relaxed)) {}
+            return r;
+        }
+    };
+
+    template<typename SIGNATURE> class atomic_callback;
+    template<typename RETURN, typename... ARGS>
+    class atomic_callback<RETURN(ARGS...)> {
+        // published nodes are immutable, store / exchange replace the whole node
+        struct node {
+            callback<RETURN(ARGS...)> target;
+            node* next;
+            std::uint64_t retired;
+
+            explicit node(callback<RETURN(ARGS...)>&& cb) : target(std::move(cb)), next(nullptr), retired(0) {}
+        };
+
+        std::atomic<node*> _current;
+        std::mutex _writer;
+        node* _retired;
+
+        node* publish(callback<RETURN(ARGS...)>&& cb) {
+            node* next = cb ? new node(std::move(cb)) : nullptr;
+            return _current.exchange(next, std::memory_order_seq_cst);
+        }
+        void retire(node* old) {
+            if (old) {
+                old->retired = epoch_domain::instance().advance();
+                old->next = _retired;
+                _retired = old;
+            }
+            collect_locked();
+        }
+        void collect_locked() {
+            epoch_domain& domain = epoch_domain::instance();
+            node** link = &_retired;
+            while (*link) {
+                node* n = *link;
+                if (domain.is_quiescent(n->retired)) {
+                    *link = n->next;
+                    delete n;
+                }
+                else link = &n->next;
+            }
+        }
+    public:
+        atomic_callback() noexcept : _current(nullptr), _retired(nullptr) {}
+        atomic_callback(callback<RETURN(ARGS...)> cb) : _current(nullptr), _retired(nullptr) {
+            if (cb) _current.store(new node(std::move(cb)), std::memory_order_release);
+        }
+        // no reader may be running when the atomic_callback is destroyed
+        ~atomic_callback() {
+            delete _current.load(std::memory_order_acquire);
+            while (_retired) {
+                node* next = _retired->next;
+                delete _retired;
+                _retired = next;
+            }
+        }
+        atomic_callback(const atomic_callback&) = delete;
+        atomic_callback& operator=(const atomic_callback&) = delete;
+
+        void store(callback<RETURN(ARGS...)> cb) {
+            std::lock_guard<std::mutex> lock(_writer);
+            retire(publish(std::move(cb)));
+        }
+        callback<RETURN(ARGS...)> exchange(callback<RETURN(ARGS...)> cb) {
+            std::lock_guard<std::mutex> lock(_writer);
+            node* old = publish(std::move(cb));
+            callback<RETURN(ARGS...)> result;
+            if (old) result = old->target;
+            retire(old);
+            return result;
+        }
+        callback<RETURN(ARGS...)> load() const {
+            epoch_domain::guard guard;
+            node* current = _current.load(std::memory_order_seq_cst);
+            return current ? current->target : callback<RETURN(ARGS...)>();
+        }
+        // destroys retired targets no reader can still hold, store / exchange also do it
+        void collect() {
+            std::lock_guard<std::mutex> lock(_writer);
+            collect_locked();
+        }
+
+        inline bool isCallable() const { return _current.load(std::memory_order_acquire) != nullptr; }
+        inline operator bool() const { return _current.load(std::memory_order_acquire) != nullptr; }
+
+        inline RETURN operator()(ARGS... args) const {
+            epoch_domain::guard guard;
+            node* current = _current.load(std::memory_order_seq_cst);
+            if (!current) throw std::bad_function_call();
+            return current->target(args...);
+        }
+    };
+}
+#endif
@@ -0,0 +1,146 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_BATCH_EXECUTOR_HPP
+#define SY_BATCH_EXECUTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "sy_callback.hpp"
+
+namespace sy_callback {
+    // runs a batch of callbacks target by target: one pass buckets them by _thunk,
+    // then every bucket is a tight loop over a single invoke function.
+    // callbacks of one bucket keep their submission order, buckets run in order of first appearance.
+    // a large span is grouped window by window, a window that fits in cache keeps the walk over
+    // a bucket from missing on every callback. the buffers are kept between runs, a steady frame loop does not allocate
+    template<typename SIGNATURE> class batch_executor;
+    template<typename RETURN, typename... ARGS>
+    class batch_executor<RETURN(ARGS...)> {
+        using callback_t    = callback<RETURN(ARGS...)>;
+        using func_invoke_t = typename callback_t::func_invoke_t;
+        using func_thunk_t  = typename callback_t::func_thunk_t;
+
+        struct bucket {
+            func_thunk_t thunk;
+            std::size_t slot;
+            std::vector<const std::uintptr_t*> objects;
+        };
+
+        std::vector<bucket> _buckets;           // in order of first appearance, vectors are reused
+        std::size_t _used;
+        std::vector<std::uint32_t> _slots;      // open addressing thunk -> bucket index + 1
+        std::size_t _mask;
+        std::size_t _window;
+
+        static std::size_t hash(func_thunk_t thunk) {
+            std::uint64_t key = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(thunk));
+            return static_cast<std::size_t>((key >> 4) * 0x9E3779B97F4A7C15ull >> 32);
+        }
+
+        void grow() {
+            std::size_t size = _slots.empty() ? 64 : _slots.size() * 2;
+            _slots.assign(size, 0);
+            _mask = size - 1;
+            for (std::size_t b = 0; b < _used; ++b) {
+                std::size_t slot = hash(_buckets[b].thunk) & _mask;
+                while (_slots[slot]) slot = (slot + 1) & _mask;
+                _slots[slot] = static_cast<std::uint32_t>(b + 1);
+                _buckets[b].slot = slot;
+            }
+        }
+
+        // the table is cleared before, not after, a segment so a throwing target leaves it usable
+        void reset() {
+            if (_slots.empty()) grow();
+            for (std::size_t b = 0; b < _used; ++b) {
+                _slots[_buckets[b].slot] = 0;
+                _buckets[b].objects.clear();
+            }
+            _used = 0;
+        }
+
+        void run_window(const callback_t* first, const callback_t* last, ARGS... args) {
+            reset();
+            for (; first != last; ++first) {
+                func_thunk_t thunk = first->_thunk;
+                std::size_t slot = hash(thunk) & _mask;
+                while (_slots[slot] && _buckets[_slots[slot] - 1].thunk != thunk) slot = (slot + 1) & _mask;
+
+                if (!_slots[slot]) {
+                    if (_used == _buckets.size()) _buckets.push_back(bucket());
+                    _buckets[_used].thunk = thunk;
+                    _buckets[_used].slot = slot;
+                    _slots[slot] = static_cast<std::uint32_t>(++_used);
+                    _buckets[_used - 1].objects.push_back(&first->_object);
+                    if (_used * 2 > _slots.size()) grow();
+                }
+                else _buckets[_slots[slot] - 1].objects.push_back(&first->_object);
+            }
+
+            for (std::size_t b = 0; b < _used; ++b) {
+                func_invoke_t invoke = _buckets[b].thunk->invoke;
+                for (const std::uintptr_t* object : _buckets[b].objects) (*invoke)(*object, args...);
+            }
+        }
+        void run_segment(const callback_t* first, const callback_t* last, ARGS... args) {
+            while (_window && static_cast<std::size_t>(last - first) > _window) {
+                run_window(first, first + _window, args...);
+                first += _window;
+            }
+            run_window(first, last, args...);
+        }
+    public:
+        // window: number of callbacks grouped together, 0 groups the whole span at once
+        explicit batch_executor(std::size_t window = 2048) : _used(0), _mask(0), _window(window) {}
+
+        std::size_t window() const { return _window; }
+        void window(std::size_t window) { _window = window; }
+
+        // every callback of the span runs once, results are discarded.
+        // empty callbacks throw bad_function_call when their bucket is reached
+        void run(const callback_t* first, std::size_t count, ARGS... args) {
+            run_segment(first, first + count, args...);
+        }
+        void run(const std::vector<callback_t>& batch, ARGS... args) {
+            run(batch.data(), batch.size(), args...);
+        }
+
+        // barrier ordered: barriers are ascending positions in the span,
+        // every callback before a barrier runs before any callback at or after it
+        void run(const callback_t* first, std::size_t count,
+                 const std::size_t* barriers, std::size_t barrier_count, ARGS... args) {
+            std::size_t begin = 0;
+            for (std::size_t b = 0; b < barrier_count; ++b) {
+                std::size_t end = barriers[b] < count ? barriers[b] : count;
+                if (end > begin) {
+                    run_segment(first + begin, first + end, args...);
+                    begin = end;
+                }
+            }
+            if (count > begin) run_segment(first + begin, first + count, args...);
+        }
+        void run(const std::vector<callback_t>& batch, const std::vector<std::size_t>& barriers, ARGS... args) {
+            run(batch.data(), batch.size(), barriers.data(), barriers.size(), args...);
+        }
+    };
+}
+#endif
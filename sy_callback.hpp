@@ -21,14 +21,623 @@
 #ifndef SY_CALLBACK_HPP
 #define SY_CALLBACK_HPP
 
+#include <atomic>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <new>
 #include <type_traits>
 #include <typeindex>
+#include <utility>
+
+#ifdef SY_CALLBACK_STATS
+#include <cstdio>
+#include <cstdlib>
+#endif
+
+#ifdef SY_CALLBACK_THUNK_NAMES
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SY_CALLBACK_PRETTY_FUNCTION __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+#define SY_CALLBACK_PRETTY_FUNCTION __FUNCSIG__
+#else
+#define SY_CALLBACK_PRETTY_FUNCTION __func__
+#endif
+// registered the first time a thunk runs, the name comes from the thunk's own template arguments
+#define SY_CALLBACK_NAME_THUNK(...)                                                          \
+    static const bool thunk_named = ::sy_callback::add_thunk_names(                              \
+        reinterpret_cast<std::uintptr_t>(__VA_ARGS__), SY_CALLBACK_PRETTY_FUNCTION);               \
+    (void)thunk_named
+// naming needs a local static, so the thunks are not constexpr and nothing is constant-initialized
+#define SY_CALLBACK_THUNK_CONSTEXPR
+#else
+#define SY_CALLBACK_NAME_THUNK(...)
+#define SY_CALLBACK_THUNK_CONSTEXPR constexpr
+#endif
+
+// make() returns a callback, which is a literal type only once its destructor is constexpr (C++20)
+#if __cplusplus >= 202002L
+#define SY_CALLBACK_CONSTEXPR20 constexpr
+#else
+#define SY_CALLBACK_CONSTEXPR20
+#endif
 
 namespace sy_callback {
-    template<typename SIGNATURE> class callback;
-    template<typename RETURN, typename... ARGS>
-    class callback<RETURN(ARGS...)> {
+#ifdef SY_CALLBACK_THUNK_NAMES
+    struct thunk_name {
+        std::uintptr_t address;     // invoke function the thunk dispatches to
+        std::string name;           // "sy_callback CLASS::FUNC", "sy_callback <target type>", ...
+    };
+
+    inline std::mutex& thunk_names_mutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+    inline std::vector<thunk_name>& thunk_names() {
+        static std::vector<thunk_name> names;
+        return names;
+    }
+
+    // GCC: "... thunk_member() [with CLASS = A; MEMBER_T = void (A::*)(); MEMBER_T FUNC = &A::f; ...]"
+    // Clang: "... thunk_member() [RETURN = void, CLASS = A, MEMBER_T = void (A::*)(), FUNC = &A::f]"
+    inline std::string thunk_target_name(const std::string& signature) {
+        std::size_t open = signature.find(") [");
+        std::size_t close = signature.rfind(']');
+        if (open == std::string::npos || close == std::string::npos || close < open) return signature;
+
+        std::string body = signature.substr(open + 3, close - open - 3);
+        if (body.compare(0, 5, "with ") == 0) body.erase(0, 5);
+        char separator = body.find("; ") != std::string::npos ? ';' : ',';
+
+        std::string func, any, object;
+        int depth = 0;
+        std::size_t begin = 0;
+        for (std::size_t i = 0; i <= body.size(); ++i) {
+            char c = i < body.size() ? body[i] : separator;
+            if (c == '<' || c == '(' || c == '[' || c == '{') ++depth;
+            else if (c == '>' || c == ')' || c == ']' || c == '}') --depth;
+            else if (c == separator && depth == 0) {
+                std::string item = body.substr(begin, i - begin);
+                begin = i + 1;
+                while (!item.empty() && item[0] == ' ') item.erase(0, 1);
+
+                std::size_t equal = item.find(" = ");
+                if (equal == std::string::npos) continue;
+                std::string key = item.substr(0, equal), value = item.substr(equal + 3);
+                bool is_func = key == "FUNC" || key.find("* FUNC)") != std::string::npos ||
+                              (key.size() > 5 && key.compare(key.size() - 5, 5, " FUNC") == 0);
+                if (is_func)
+                    func = value[0] == '&' ? value.substr(1) : value;
+                else if (key == "ANY_T") any = value;
+                else if (key == "CLASS") object = value;
+            }
+        }
+        if (!func.empty())      return "sy_callback " + func;
+        if (!any.empty())       return "sy_callback " + any;
+        if (!object.empty())    return "sy_callback " + object + "::* (runtime member)";
+        return "sy_callback function pointer";
+    }
+
+    inline bool add_thunk_names(const std::uintptr_t* addresses, std::size_t count, const char* signature) {
+        std::string name = thunk_target_name(signature);
+        std::lock_guard<std::mutex> lock(thunk_names_mutex());
+        for (std::size_t i = 0; i < count; ++i) {
+            bool known = false;
+            for (const thunk_name& entry : thunk_names()) known = known || entry.address == addresses[i];
+            if (!known) thunk_names().push_back(thunk_name{ addresses[i], name });
+        }
+        return true;
+    }
+    inline bool add_thunk_names(std::uintptr_t address, const char* signature) {
+        return add_thunk_names(&address, 1, signature);
+    }
+
+    // visitor(const thunk_name&) for every thunk that has run so far
+    template<typename VISITOR>
+    void for_each_thunk_name(VISITOR visitor) {
+        std::lock_guard<std::mutex> lock(thunk_names_mutex());
+        for (const thunk_name& entry : thunk_names()) visitor(entry);
+    }
+    inline std::string find_thunk_name(const void* address) {
+        std::lock_guard<std::mutex> lock(thunk_names_mutex());
+        for (const thunk_name& entry : thunk_names())
+            if (entry.address == reinterpret_cast<std::uintptr_t>(address)) return entry.name;
+        return std::string();
+    }
+    // one "ADDRESS NAME" line per thunk, to symbolize raw sample addresses (perf script, ...)
+    inline bool write_thunk_names(std::FILE* file) {
+        std::lock_guard<std::mutex> lock(thunk_names_mutex());
+        for (const thunk_name& entry : thunk_names())
+            if (std::fprintf(file, "%llx %s\n", static_cast<unsigned long long>(entry.address), entry.name.c_str()) < 0) 
+                return false;
+        return true;
+    }
+#endif
+
+#ifdef SY_CALLBACK_STATS
+    // per thread counters, summed over every thread by global(); threads only ever write their own record
+    namespace stats {
+        enum counter_t : std::size_t { allocations, deep_copies, moves, destroys, empty_calls, counter_count };
+
+        struct counters {
+            std::uint64_t allocations;      // heap stored targets created
+            std::uint64_t deep_copies;      // heap stored targets copied (life_any, owned member bindings)
+            std::uint64_t moves;            // move constructions and move assignments
+            std::uint64_t destroys;         // targets destroyed
+            std::uint64_t empty_calls;      // calls of an empty callback (bad_function_call)
+        };
+
+        struct record {
+            std::atomic<std::uint64_t> values[counter_count];
+            std::atomic<bool> in_use;
+            record* next;
+
+            record() : in_use(true), next(nullptr) {
+                for (std::atomic<std::uint64_t>& v : values) v.store(0, std::memory_order_relaxed);
+            }
+        };
+
+        inline std::atomic<record*>& records() {
+            static std::atomic<record*> head(nullptr);
+            return head;
+        }
+        // records are never freed, a thread that exits leaves its counts (and its record) to the next one
+        inline record* acquire() {
+            for (record* r = records().load(std::memory_order_acquire); r; r = r->next) {
+                bool expected = false;
+                if (!r->in_use.load(std::memory_order_relaxed) &&
+                    r->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) return r;
+            }
+            record* r = new record();
+            r->next = records().load(std::memory_order_relaxed);
+            while (!records().compare_exchange_weak(r->next, r, std::memory_order_release, std::memory_order_relaxed)) {}
+            return r;
+        }
+        // a reused record keeps the counts of its previous thread, _base is where this thread started
+        struct holder {
+            record* _record;
+            std::uint64_t _base[counter_count];
+            holder() : _record(acquire()) {
+                for (std::size_t i = 0; i < counter_count; ++i) _base[i] = _record->values[i].load(std::memory_order_relaxed);
+            }
+            ~holder() { _record->in_use.store(false, std::memory_order_release); }
+        };
+        inline holder& local_holder() {
+            static thread_local holder local;
+            return local;
+        }
+
+        inline void count(counter_t counter) {
+            std::atomic<std::uint64_t>& value = local_holder()._record->values[counter];
+            value.store(value.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        inline counters make_counters(const std::uint64_t (&values)[counter_count]) {
+            counters c = { values[allocations], values[deep_copies], values[moves], values[destroys], values[empty_calls] };
+            return c;
+        }
+        // counts of the calling thread since it started
+        inline counters local() {
+            holder& h = local_holder();
+            std::uint64_t values[counter_count];
+            for (std::size_t i = 0; i < counter_count; ++i)
+                values[i] = h._record->values[i].load(std::memory_order_relaxed) - h._base[i];
+            return make_counters(values);
+        }
+        // counts of every thread, exited ones included
+        inline counters global() {
+            std::uint64_t values[counter_count] = {};
+            for (record* r = records().load(std::memory_order_acquire); r; r = r->next)
+                for (std::size_t i = 0; i < counter_count; ++i) values[i] += r->values[i].load(std::memory_order_relaxed);
+            return make_counters(values);
+        }
+
+        inline bool dump(std::FILE* file, const counters& c) {
+            return std::fprintf(file, 
+                "sy_callback stats: allocations %llu, deep copies %llu, moves %llu, destroys %llu, empty calls %llu\n",
+                static_cast<unsigned long long>(c.allocations), static_cast<unsigned long long>(c.deep_copies),
+                static_cast<unsigned long long>(c.moves), static_cast<unsigned long long>(c.destroys),
+                static_cast<unsigned long long>(c.empty_calls)) >= 0;
+        }
+        inline bool dump(std::FILE* file = stderr) { return dump(file, global()); }
+
+        // counts of the current thread inside a block; with no_allocations set,
+        // leaving the block after a heap allocation prints the counts and aborts
+        class scope {
+            counters _start;
+            bool _no_allocations;
+        public:
+            explicit scope(bool no_allocations = false) : _start(local()), _no_allocations(no_allocations) {}
+            ~scope() {
+                if (_no_allocations && delta().allocations != 0) {
+                    std::fprintf(stderr, "sy_callback::stats::scope: %llu allocation(s) in a no-allocation scope\n",
+                        static_cast<unsigned long long>(delta().allocations));
+                    dump(stderr, delta());
+                    std::abort();
+                }
+            }
+            scope(const scope&) = delete;
+            scope& operator=(const scope&) = delete;
+
+            counters delta() const {
+                counters now = local();
+                counters c = {
+                    now.allocations - _start.allocations, now.deep_copies - _start.deep_copies,
+                    now.moves - _start.moves, now.destroys - _start.destroys, now.empty_calls - _start.empty_calls
+                };
+                return c;
+            }
+        };
+    }
+#define SY_CALLBACK_COUNT(COUNTER) ::sy_callback::stats::count(::sy_callback::stats::COUNTER)
+#else
+#define SY_CALLBACK_COUNT(COUNTER) ((void)0)
+#endif
+
+#ifdef SY_CALLBACK_POOL
+    // small-object allocator for heap stored targets: every thread owns a heap with one free list
+    // per 16 byte size class, a block freed by another thread goes back through the owner's
+    // lock-free remote stack. heaps are never destroyed, a thread that exits leaves its heap to the next one
+    class pool {
+    public:
+        static constexpr std::size_t granule = 16;
+        static constexpr std::size_t classes = 16;          // blocks up to 256 bytes
+        static constexpr std::size_t chunk_size = 64 * 1024;
+
+        struct statistics {
+            std::uint64_t allocations;      // blocks handed out
+            std::uint64_t local_frees;      // blocks freed by their owner thread
+            std::uint64_t remote_frees;     // blocks freed by another thread
+            std::uint64_t chunks;           // requests to the global allocator
+        };
+
+    private:
+        struct heap;
+
+        // 16 byte header in front of every block, keeps the payload aligned like max_align_t
+        struct alignas(granule) header {
+            heap* owner;                    // nullptr: allocated after the thread's heap was released
+            std::size_t size_class;
+        };
+        struct block {
+            block* next;
+        };
+
+        struct heap {
+            block* free[classes];
+            std::atomic<block*> remote;
+            char* cursor;
+            char* limit;
+            std::atomic<bool> in_use;
+            heap* next;
+            std::atomic<std::uint64_t> counters[4];
+
+            heap() : remote(nullptr), cursor(nullptr), limit(nullptr), in_use(true), next(nullptr) {
+                for (block*& b : free) b = nullptr;
+                for (std::atomic<std::uint64_t>& c : counters) c.store(0, std::memory_order_relaxed);
+            }
+            // only the owner thread writes its counters
+            void count(std::size_t index) {
+                counters[index].store(counters[index].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+        };
+
+        struct holder {
+            heap* _heap;
+            holder() : _heap(pool::acquire()) { current() = _heap; }
+            ~holder() {
+                current() = nullptr;
+                released() = true;
+                _heap->in_use.store(false, std::memory_order_release);
+            }
+        };
+
+        static std::atomic<heap*>& heads() {
+            static std::atomic<heap*> head(nullptr);
+            return head;
+        }
+        static heap*& current() {
+            static thread_local heap* local = nullptr;
+            return local;
+        }
+        static bool& released() {
+            static thread_local bool done = false;
+            return done;
+        }
+        static heap* local() {
+            heap* h = current();
+            if (h || released()) return h;
+            static thread_local holder local_holder;
+            return local_holder._heap;
+        }
+
+        static heap* acquire() {
+            for (heap* h = heads().load(std::memory_order_acquire); h; h = h->next) {
+                bool expected = false;
+                if (!h->in_use.load(std::memory_order_relaxed) &&
+                    h->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) return h;
+            }
+            heap* h = new heap();
+            h->next = heads().load(std::memory_order_relaxed);
+            while (!heads().compare_exchange_weak(h->next, h, std::memory_order_release, std::memory_order_relaxed)) {}
+            return h;
+        }
+
+        static block* payload(header* h) { return reinterpret_cast<block*>(h + 1); }
+        static header* header_of(void* p) { return reinterpret_cast<header*>(p) - 1; }
+
+        static void* refill(heap* h, std::size_t size_class) {
+            // blocks freed by other threads first
+            block* remote = h->remote.exchange(nullptr, std::memory_order_acquire);
+            while (remote) {
+                block* next = remote->next;
+                std::size_t c = header_of(remote)->size_class;
+                remote->next = h->free[c];
+                h->free[c] = remote;
+                remote = next;
+            }
+            if (block* b = h->free[size_class]) {
+                h->free[size_class] = b->next;
+                return b;
+            }
+
+            std::size_t bytes = sizeof(header) + (size_class + 1) * granule;
+            if (static_cast<std::size_t>(h->limit - h->cursor) < bytes) {
+                h->cursor = static_cast<char*>(::operator new(chunk_size));
+                h->limit = h->cursor + chunk_size;
+                h->count(3);
+            }
+            header* head = reinterpret_cast<header*>(h->cursor);
+            h->cursor += bytes;
+            head->owner = h;
+            head->size_class = size_class;
+            return payload(head);
+        }
+
+    public:
+        static void* allocate(std::size_t size) {
+            std::size_t size_class = (size - 1) / granule;       // size is a sizeof, never 0
+            heap* h = local();
+            if (!h) {
+                header* head = static_cast<header*>(::operator new(sizeof(header) + size));
+                head->owner = nullptr;
+                head->size_class = size_class;
+                return payload(head);
+            }
+            h->count(0);
+            if (block* b = h->free[size_class]) {
+                h->free[size_class] = b->next;
+                return b;
+            }
+            return refill(h, size_class);
+        }
+
+        static void deallocate(void* p) {
+            header* head = header_of(p);
+            heap* owner = head->owner;
+            if (!owner) {
+                ::operator delete(head);
+                return;
+            }
+            block* b = static_cast<block*>(p);
+            heap* h = current();
+            if (owner == h) {
+                b->next = h->free[head->size_class];
+                h->free[head->size_class] = b;
+                h->count(1);
+                return;
+            }
+            if (h) h->count(2);
+            b->next = owner->remote.load(std::memory_order_relaxed);
+            while (!owner->remote.compare_exchange_weak(b->next, b, std::memory_order_release, std::memory_order_relaxed)) {}
+        }
+
+        // sum over every heap, exact once the threads have stopped allocating
+        static statistics stats() {
+            statistics s = { 0, 0, 0, 0 };
+            for (heap* h = heads().load(std::memory_order_acquire); h; h = h->next) {
+                s.allocations   += h->counters[0].load(std::memory_order_relaxed);
+                s.local_frees   += h->counters[1].load(std::memory_order_relaxed);
+                s.remote_frees  += h->counters[2].load(std::memory_order_relaxed);
+                s.chunks        += h->counters[3].load(std::memory_order_relaxed);
+            }
+            return s;
+        }
+    };
+
+    template<typename T>                struct      pool_eligible {
+        static constexpr bool value =
+            sizeof(T) <= pool::granule * pool::classes && alignof(T) <= pool::granule;
+    };
+    template<typename T, typename... PARAMS>
+    T* new_object_tagged(std::true_type, PARAMS&&... params) {
+        void* memory = pool::allocate(sizeof(T));
+        try { return new (memory) T(std::forward<PARAMS>(params)...); }
+        catch (...) {
+            pool::deallocate(memory);
+            throw;
+        }
+    }
+    template<typename T>
+    void delete_object_tagged(std::true_type, T* object) {
+        object->~T();
+        pool::deallocate(object);
+    }
+    template<typename T>
+    void* allocate_storage_tagged(std::true_type) { return pool::allocate(sizeof(T)); }
+    template<typename T>
+    void deallocate_storage_tagged(std::true_type, void* memory) { pool::deallocate(memory); }
+#else
+    template<typename T>                struct      pool_eligible : std::false_type {};
+#endif
+
+    // heap storage of targets, routed through the pool when SY_CALLBACK_POOL is defined
+    template<typename T, typename... PARAMS>
+    T* new_object_tagged(std::false_type, PARAMS&&... params) { return new T(std::forward<PARAMS>(params)...); }
+    template<typename T>
+    void delete_object_tagged(std::false_type, T* object) { delete object; }
+    template<typename T>
+    void* allocate_storage_tagged(std::false_type) { return ::operator new(sizeof(T)); }
+    template<typename T>
+    void deallocate_storage_tagged(std::false_type, void* memory) { ::operator delete(memory); }
+
+    template<typename T, typename... PARAMS>
+    T* new_object(PARAMS&&... params) {
+        SY_CALLBACK_COUNT(allocations);
+        return new_object_tagged<T>(std::integral_constant<bool, pool_eligible<T>::value>(), std::forward<PARAMS>(params)...);
+    }
+    template<typename T>
+    void delete_object(T* object) { delete_object_tagged<T>(std::integral_constant<bool, pool_eligible<T>::value>(), object); }
+    // copy of a heap target, nullptr for move-only types (a callback holding one copies as empty)
+    template<typename T>
+    T* copy_object_tagged(std::true_type, const T& object) { return new_object<T>(object); }
+    template<typename T>
+    T* copy_object_tagged(std::false_type, const T&) { return nullptr; }
+    template<typename T>
+    T* copy_object(const T& object) { return copy_object_tagged<T>(std::is_copy_constructible<T>(), object); }
+    // raw storage for placement new, for types that must not go through a (virtual) delete expression
+    template<typename T>
+    void* allocate_storage() {
+        SY_CALLBACK_COUNT(allocations);
+        return allocate_storage_tagged<T>(std::integral_constant<bool, pool_eligible<T>::value>());
+    }
+    template<typename T>
+    void deallocate_storage(void* memory) {
+        deallocate_storage_tagged<T>(std::integral_constant<bool, pool_eligible<T>::value>(), memory);
+    }
+    // copy_object into raw storage, nullptr for move-only types
+    template<typename T>
+    T* copy_storage_tagged(std::true_type, const T& object) {
+        void* memory = allocate_storage<T>();
+        try { return new (memory) T(object); }
+        catch (...) {
+            deallocate_storage<T>(memory);
+            throw;
+        }
+    }
+    template<typename T>
+    T* copy_storage_tagged(std::false_type, const T&) { return nullptr; }
+    template<typename T>
+    T* copy_storage(const T& object) { return copy_storage_tagged<T>(std::is_copy_constructible<T>(), object); }
+
+    // base class for objects bound with callback::make_tracked: the object owns a small shared
+    // control block (created on the first tracked binding) whose alive flag it clears when destroyed,
+    // so every callback bound to it reports false from isCallable() afterwards
+    class trackable {
+    public:
+        struct control {
+            std::atomic<bool> alive;
+            std::atomic<std::size_t> refs;      // the object and every callback holding the block
+            const trackable* owner;             // read only while alive is set
+        };
+
+        trackable() noexcept : _control(nullptr) {}
+        // a copy is a different object: callbacks keep tracking the original
+        trackable(const trackable&) noexcept : _control(nullptr) {}
+        trackable& operator=(const trackable&) noexcept { return *this; }
+        ~trackable() {
+            control* block = _control.load(std::memory_order_acquire);
+            if (!block) return;
+            block->alive.store(false, std::memory_order_release);
+            release(block);
+        }
+
+        // control block with a reference added for the caller
+        control* track() const {
+            control* block = _control.load(std::memory_order_acquire);
+            if (!block) {
+                control* created = new control;
+                created->alive.store(true, std::memory_order_relaxed);
+                created->refs.store(1, std::memory_order_relaxed);
+                created->owner = this;
+                if (_control.compare_exchange_strong(block, created, std::memory_order_acq_rel)) block = created;
+                else delete created;
+            }
+            block->refs.fetch_add(1, std::memory_order_relaxed);
+            return block;
+        }
+        static void retain(control* block) { block->refs.fetch_add(1, std::memory_order_relaxed); }
+        static void release(control* block) {
+            if (block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete block;
+        }
+
+    private:
+        mutable std::atomic<control*> _control;
+    };
+
+    // cancellation_source::cancel() sets one flag shared by its tokens and by every callback made with
+    // callback::make_cancellable, however many there are. A callback checks the flag with one relaxed load
+    class cancellation_token {
+    public:
+        struct control {
+            std::atomic<bool> cancelled;
+            std::atomic<std::size_t> refs;      // the sources, the tokens and every callback holding the block
+        };
+
+        cancellation_token() noexcept : _control(nullptr) {}
+        explicit cancellation_token(control* block) noexcept : _control(block) { if (block) retain(block); }
+        cancellation_token(const cancellation_token& other) noexcept : cancellation_token(other._control) {}
+        cancellation_token(cancellation_token&& other) noexcept : _control(other._control) { other._control = nullptr; }
+        cancellation_token& operator=(cancellation_token other) noexcept {
+            std::swap(_control, other._control);
+            return *this;
+        }
+        ~cancellation_token() { if (_control) release(_control); }
+
+        // a default constructed token is never cancelled
+        bool cancelled() const noexcept { return _control && _control->cancelled.load(std::memory_order_relaxed); }
+        control* block() const noexcept { return _control; }
+
+        static void retain(control* block) { block->refs.fetch_add(1, std::memory_order_relaxed); }
+        static void release(control* block) {
+            if (block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete block;
+        }
+
+    private:
+        control* _control;
+    };
+
+    // copies share one flag, like the tokens. Destroying the last source does not cancel
+    class cancellation_source {
+    public:
+        cancellation_source() : _token(new_block()) {}
+
+        void cancel() noexcept { if (_token.block()) _token.block()->cancelled.store(true, std::memory_order_relaxed); }
+        bool cancelled() const noexcept { return _token.cancelled(); }
+        const cancellation_token& token() const noexcept { return _token; }
+
+    private:
+        static cancellation_token new_block() {
+            cancellation_token::control* block = new cancellation_token::control;
+            block->cancelled.store(false, std::memory_order_relaxed);
+            block->refs.store(0, std::memory_order_relaxed);
+            return cancellation_token(block);
+        }
+
+        cancellation_token _token;
+    };
+
+    // widest member function pointer: forward-declared class, so no ABI shortcut applies
+    struct unknown_class;
+    constexpr std::size_t member_pointer_words =
+        (sizeof(void (unknown_class::*)()) + sizeof(std::uintptr_t) - 1) / sizeof(std::uintptr_t);
+
+    // WORDS is the inline storage in words. The default keeps a callback at two pointers, see wide_callback
+    template<typename SIGNATURE, std::size_t WORDS = 1> class callback;
+    // room for an object pointer and any member function pointer (four pointers on the Itanium ABI):
+    // runtime member bindings, cancellable two-word functors and functors of up to three words stay inline
+    template<typename SIGNATURE> using wide_callback = callback<SIGNATURE, 1 + member_pointer_words>;
+    template<typename... SIGNATURES> class multi_callback;
+    template<typename SIGNATURE> class batch_executor;
+    template<typename SIGNATURE> class sharded_registry;
+    template<typename RETURN, typename... ARGS, std::size_t WORDS>
+    class callback<RETURN(ARGS...), WORDS> {
+        static_assert(WORDS > 0, "callback storage needs at least one word");
         template <typename T, typename = void>  struct      is_functor : std::false_type {};
         template<typename...>                   using       my_void_t = void;
         template<typename T>                    struct      is_functor<T, my_void_t<decltype(&T::operator())>> : std::true_type {};
@@ -60,151 +669,211 @@ namespace sy_callback {
                     C
                 >::value;
         };   
+        template<typename O, typename M>        struct      is_member_invocable_r {
+        private:
+            template<typename U, typename V>
+            static auto test(int) -> typename std::is_convertible<
+                decltype((std::declval<U>().*std::declval<V>())(std::declval<ARGS>()...)),
+                RETURN
+            >::type;
+
+            template<typename, typename>
+            static std::false_type test(...);
+
+        public:
+            // lvalue: callable as (object.*func)(args...), rvalue: only as (std::move(object).*func)(args...)
+            static constexpr bool lvalue = decltype(test<O&, M>(0))::value;
+            static constexpr bool rvalue = decltype(test<O&&, M>(0))::value;
+            static constexpr bool value = lvalue || rvalue;
+        };
+        // pointer bindings call (object->*func)(args...), so they need lvalue
+        template<typename O, typename M>        struct      is_bindable_member {
+            static constexpr bool value  = std::is_member_function_pointer<M>::value && is_member_invocable_r<O, M>::value;
+            static constexpr bool lvalue = std::is_member_function_pointer<M>::value && is_member_invocable_r<O, M>::lvalue;
+        };
         
+        // expired: nonzero when the target is gone and the callback should count as empty.
+        // equal: nonzero when "other", holding the same thunk, has the same target. hash: a word consistent with equal.
+        // identity: nonzero when the target only equals itself, so no other callback can ever compare equal
         enum struct key_t : std::uint8_t{ 
-            copy, destroy, get_name 
+            copy, destroy, get_name, expired, equal, hash, identity 
         };
         
         using func_invoke_t = RETURN(*)(const std::uintptr_t&, ARGS...);
-        using func_life_t = std::uintptr_t(*)(key_t, const std::uintptr_t&);
-        using func_thunk_t = std::uintptr_t(*)(bool);
+        using func_life_t = std::uintptr_t(*)(key_t, const std::uintptr_t&, std::uintptr_t&);
+        // one static table per target kind: _thunk points to it, so a call is a single indirect branch.
+        // trivial: the target owns nothing, it is copied bitwise and never destroyed or expired;
+        // life is still set, its address identifies the bound class for target<CLASS>().
+        // expirable: the target can expire (tracked and cancellable bindings), isCallable() asks life only then
+        struct thunk_table {
+            func_invoke_t invoke;
+            func_life_t life;
+            bool trivial;
+            bool expirable;
+        };
+        using func_thunk_t = const thunk_table*;
+
+        static constexpr std::size_t storage_words = WORDS;
 
         template<typename CLASS>                struct      target_func{
         private:
-            std::uintptr_t _object;
+            const std::uintptr_t* _object;
+            CLASS* _pointer;
             func_thunk_t _thunk;
 
             friend class callback;
 
-            target_func(const std::uintptr_t& object, func_thunk_t thunk) : _object(object), _thunk(thunk) {}
+            target_func(const std::uintptr_t* object, CLASS* pointer, func_thunk_t thunk) 
+                : _object(object), _pointer(pointer), _thunk(thunk) {}
         public:
             operator bool() {
-                return _object;
+                return _pointer;
             }
             CLASS* operator->() {
-                return reinterpret_cast<CLASS*>(_object);
+                return _pointer;
             }
             inline RETURN operator()(ARGS... args) const { 
-                return (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...); 
+                return (*_thunk->invoke)(*_object, args...); 
             }
             target_func& operator*() { return *this; }
             const target_func& operator*() const { return *this; }
         };
 
-        std::uintptr_t _object;
+        // _object is the first word of _storage: invoke/life receive it by reference,
+        // so thunks that keep more than one word (runtime member pointers, inline objects) read past it
+        // _pointer / _function are only written by the constexpr constructors (no reinterpret_cast there),
+        // everything else reads the same bits through _object
+        union {
+            std::uintptr_t _object;
+            std::uintptr_t _storage[storage_words];
+            const volatile void* _pointer;
+            RETURN(*_function)(ARGS...);
+        };
         func_thunk_t _thunk;
 
+        constexpr callback(const volatile void* object, func_thunk_t thunk) noexcept : _pointer(object), _thunk(thunk) {}
+        constexpr callback(RETURN(*func)(ARGS...), func_thunk_t thunk) noexcept : _function(func), _thunk(thunk) {}
+
+        template<typename...> friend class multi_callback;
+        template<typename> friend class batch_executor;
+        template<typename> friend class sharded_registry;
+
 #pragma region INVOKE TABLE
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) > 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) &> 
+        // every cv / ref / noexcept qualifier shares this one template: MEMBER_T is the exact member pointer type
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
         static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
             return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const &> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
+        template<typename CLASS, typename MEMBER_T>
+        static RETURN invoke_member_runtime(const std::uintptr_t& object, ARGS... args) {
+            const std::uintptr_t* binding = member_binding(object);
+            MEMBER_T func;
+            std::memcpy(&func, binding + 1, sizeof(MEMBER_T));
+            return call_member(std::integral_constant<bool, is_member_invocable_r<CLASS, MEMBER_T>::lvalue>(),
+                                reinterpret_cast<CLASS*>(binding[0]), func, args...);
+        }
+        // a runtime member binding is the object pointer followed by the member function pointer, zero filled:
+        // inline when the storage has room for it (wide_callback), otherwise one heap record the callback owns
+        struct member_record {
+            std::uintptr_t words[1 + member_pointer_words];
+        };
+        static constexpr bool member_record_inline = storage_words >= 1 + member_pointer_words;
+        static const std::uintptr_t* member_binding(const std::uintptr_t& object) {
+            return member_binding(object, std::integral_constant<bool, member_record_inline>());
+        }
+        static const std::uintptr_t* member_binding(const std::uintptr_t& object, std::true_type) { return &object; }
+        static const std::uintptr_t* member_binding(const std::uintptr_t& object, std::false_type) {
+            return reinterpret_cast<const member_record*>(object)->words;
+        }
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static RETURN invoke_member_inline(const std::uintptr_t& object, ARGS... args) {
+            return call_member(std::integral_constant<bool, is_member_invocable_r<CLASS, MEMBER_T>::lvalue>(),
+                                reinterpret_cast<CLASS*>(const_cast<std::uintptr_t*>(&object)), FUNC, args...);
+        }
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static RETURN invoke_member_value(const std::uintptr_t& object, ARGS... args) {
+            return call_member(std::integral_constant<bool, is_member_invocable_r<CLASS, MEMBER_T>::lvalue>(),
+                                reinterpret_cast<CLASS*>(object), FUNC, args...);
+        }
+        // _object holds the object's trackable::control, which points back to the object.
+        // a dead object behaves like an empty callback
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static RETURN invoke_member_tracked(const std::uintptr_t& object, ARGS... args) {
+            const trackable::control* block = reinterpret_cast<const trackable::control*>(object);
+            if (!block->alive.load(std::memory_order_acquire)) throw std::bad_function_call();
+            return (static_cast<CLASS*>(const_cast<trackable*>(block->owner))->*FUNC)(args...);
+        }
+        // INLINE: the target fills the storage up to its last word, which holds the cancellation_token::control.
+        // otherwise _object points to a cancellable_node holding both.
+        // a call after cancel() only reads the flag: the target stays until a non-const path releases it
+        template<typename ANY_T, bool INLINE>
+        static RETURN invoke_cancellable(const std::uintptr_t& object, ARGS... args) {
+            if (cancellable_block<ANY_T>(object, std::integral_constant<bool, INLINE>())->cancelled.load(std::memory_order_relaxed))
+                return cancelled_call(std::is_void<RETURN>());
+            return (*cancellable_target<ANY_T>(object, std::integral_constant<bool, INLINE>()))(args...);
+        }
+        static RETURN invoke_cancelled(const std::uintptr_t&, ARGS...) {
+            return cancelled_call(std::is_void<RETURN>());
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile &> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
+        template<typename ANY_T>
+        struct cancellable_node {
+            cancellation_token::control* block;
+            ANY_T target;
+
+            template<typename T>
+            cancellable_node(cancellation_token::control* b, T&& func) : block(b), target(std::forward<T>(func)) {}
+        };
+        template<typename ANY_T>
+        static ANY_T* cancellable_target(const std::uintptr_t& object, std::true_type) {
+            return reinterpret_cast<ANY_T*>(const_cast<std::uintptr_t*>(&object));
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile &> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
+        template<typename ANY_T>
+        static ANY_T* cancellable_target(const std::uintptr_t& object, std::false_type) {
+            return &reinterpret_cast<cancellable_node<ANY_T>*>(object)->target;
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) &&> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
+        template<typename ANY_T>
+        static cancellation_token::control* cancellable_block(const std::uintptr_t& object, std::true_type) {
+            return reinterpret_cast<cancellation_token::control*>((&object)[storage_words - 1]);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const &&> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
+        template<typename ANY_T>
+        static cancellation_token::control* cancellable_block(const std::uintptr_t& object, std::false_type) {
+            return reinterpret_cast<const cancellable_node<ANY_T>*>(object)->block;
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile &&> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
+        // a cancelled void callback does nothing, one that returns a value has nothing to return
+        static RETURN cancelled_call(std::true_type) {}
+        static RETURN cancelled_call(std::false_type) { throw std::bad_function_call(); }
+        template<typename CLASS, typename MEMBER_T>
+        static RETURN call_member(std::true_type, CLASS* object, MEMBER_T func, ARGS... args) {
+            return (object->*func)(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile &&> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
+        template<typename CLASS, typename MEMBER_T>
+        static RETURN call_member(std::false_type, CLASS* object, MEMBER_T func, ARGS... args) {
+            return (std::move(*object).*func)(args...);
         }
 
         static RETURN invoke_pointer_not_noexcept(const std::uintptr_t& object, ARGS... args) {
             return (*reinterpret_cast<RETURN(*)(ARGS...)>(object))(args...);
         }
+        // lazily bound target: every call asks the resolver, which caches the address after the first one.
+        // the callback itself is never written to, so a const call stays a read and copies share the resolution
+        template<typename RESOLVER>
+        static RETURN invoke_lazy(const std::uintptr_t& object, ARGS... args) {
+            void* address = RESOLVER::resolve(reinterpret_cast<const void*>(object));
+            if (!address) throw std::bad_function_call();
+            return (*reinterpret_cast<RETURN(*)(ARGS...)>(address))(args...);
+        }
         
         template<typename ANY_T>
         static RETURN invoke_any(const std::uintptr_t& object, ARGS... args) {
             return (*reinterpret_cast<ANY_T*>(object))(args...);
         }
 
-        static RETURN invoke_nothing(const std::uintptr_t&, ARGS...) { throw std::bad_function_call(); }
-
-#if __cplusplus >= 201703L
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) & noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const & noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile & noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile & noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) && noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const && noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile && noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile && noexcept> 
-        static RETURN invoke_member(const std::uintptr_t& object, ARGS... args) {
-            return (reinterpret_cast<CLASS*>(object)->*FUNC)(args...);
+        static RETURN invoke_nothing(const std::uintptr_t&, ARGS...) { 
+            SY_CALLBACK_COUNT(empty_calls);
+            throw std::bad_function_call(); 
         }
 
+#if __cplusplus >= 201703L
         static RETURN invoke_pointer_noexcept(const std::uintptr_t& object, ARGS... args) {
             return (*reinterpret_cast<RETURN(*)(ARGS...) noexcept>(object))(args...);
         }
@@ -212,411 +881,593 @@ namespace sy_callback {
 #endif
 #pragma endregion
 #pragma region LIFE TABLE
+        // copy: "other" already holds a bitwise copy of the storage, the life function
+        // replaces it with a real copy and returns 0 when the target can't be copied
         template<typename CLASS> 
-        static std::uintptr_t life_member(key_t type, const std::uintptr_t& object) {
-            return object;
+        static std::uintptr_t life_member(key_t type, const std::uintptr_t& object, std::uintptr_t& other) {
+            if (type == key_t::equal) return object == other;
+            return type == key_t::expired || type == key_t::identity ? 0 : object;
         }     
+        // see member_record: copy and destroy only run for the heap record
+        template<typename CLASS>
+        static std::uintptr_t life_member_runtime(key_t type, const std::uintptr_t& object, std::uintptr_t& other) {
+            const std::uintptr_t* words = member_binding(object);
+            if (type == key_t::copy) {
+                SY_CALLBACK_COUNT(deep_copies);
+                other = reinterpret_cast<std::uintptr_t>(new_object<member_record>(*reinterpret_cast<const member_record*>(object)));
+                return 1;
+            }
+            else if (type == key_t::destroy) delete_object(reinterpret_cast<member_record*>(object));
+            else if (type == key_t::equal) return std::memcmp(words, member_binding(other), sizeof(member_record)) == 0;
+            else if (type == key_t::hash) {
+                std::uintptr_t hash = 0;
+                for (std::size_t i = 0; i < 1 + member_pointer_words; ++i) hash = hash * 31 + words[i];
+                return hash;
+            }
+            return type == key_t::expired || type == key_t::identity ? 0 : 1;
+        }
+        static std::uintptr_t life_member_tracked(key_t type, const std::uintptr_t& object, std::uintptr_t& other) {
+            trackable::control* block = reinterpret_cast<trackable::control*>(object);
+            if (type == key_t::equal) return object == other;
+            else if (type == key_t::hash) return object;
+            else if (type == key_t::copy) trackable::retain(block);
+            else if (type == key_t::destroy) trackable::release(block);
+            else if (type == key_t::expired) return !block->alive.load(std::memory_order_acquire);
+            else if (type == key_t::identity) return 0;
+            return 1;
+        }
+        template<typename CLASS>
+        static std::uintptr_t life_member_inline(key_t type, const std::uintptr_t& object, std::uintptr_t& other) {
+            CLASS* orig = reinterpret_cast<CLASS*>(const_cast<std::uintptr_t*>(&object));
+            if (type == key_t::copy) {
+                new (&other) CLASS(*orig);
+                return 1;
+            }
+            else if (type == key_t::destroy) orig->~CLASS();
+            else if (type == key_t::equal) return equal_targets(orig, reinterpret_cast<CLASS*>(&other));
+            else if (type == key_t::hash) return hash_target(orig);
+            else if (type == key_t::identity) return compared_by_identity<CLASS>::value;
+            return 0;
+        }
+        template<typename CLASS>
+        static std::uintptr_t life_member_value(key_t type, const std::uintptr_t& object, std::uintptr_t& other) {
+            if (type == key_t::copy) {
+                CLASS* copy_obj = copy_storage<CLASS>(*reinterpret_cast<CLASS*>(object));
+                if (!copy_obj) return 0;
+                SY_CALLBACK_COUNT(deep_copies);
+                other = reinterpret_cast<std::uintptr_t>(copy_obj);
+                return other;
+            }
+            else if (type == key_t::destroy) {
+                reinterpret_cast<CLASS*>(object)->~CLASS();
+                deallocate_storage<CLASS>(reinterpret_cast<void*>(object));
+            }
+            else if (type == key_t::equal) return equal_targets(reinterpret_cast<CLASS*>(object), reinterpret_cast<CLASS*>(other));
+            else if (type == key_t::hash) return hash_target(reinterpret_cast<CLASS*>(object));
+            else if (type == key_t::identity) return compared_by_identity<CLASS>::value;
+            return 0;
+        }
         template<typename ANY_T>
-        static std::uintptr_t life_any(key_t type, const std::uintptr_t& object) {    
+        static std::uintptr_t life_any(key_t type, const std::uintptr_t& object, std::uintptr_t& other) {    
             if (type == key_t::copy) {
                 if (!std::is_copy_constructible<ANY_T>::value) return 0;
 
                 ANY_T* orig = reinterpret_cast<ANY_T*>(object);
-                ANY_T* copy_obj = new ANY_T(*orig);
-                return reinterpret_cast<std::uintptr_t>(copy_obj);
+                SY_CALLBACK_COUNT(deep_copies);
+                ANY_T* copy_obj = copy_object<ANY_T>(*orig);
+                other = reinterpret_cast<std::uintptr_t>(copy_obj);
+                return other;
             }
-            else if (type == key_t::destroy ) delete reinterpret_cast<ANY_T*>(object);
+            else if (type == key_t::destroy ) delete_object(reinterpret_cast<ANY_T*>(object));
+            else if (type == key_t::equal) return equal_targets(reinterpret_cast<ANY_T*>(object), reinterpret_cast<ANY_T*>(other));
+            else if (type == key_t::hash) return hash_target(reinterpret_cast<ANY_T*>(object));
+            else if (type == key_t::identity) return compared_by_identity<ANY_T>::value;
             return 0;
         }
-        static std::uintptr_t life_global(key_t type, const std::uintptr_t& object) {
-            return object;
+        template<typename ANY_T, bool INLINE>
+        static std::uintptr_t life_cancellable(key_t type, const std::uintptr_t& object, std::uintptr_t& other) {
+            using node_t = cancellable_node<ANY_T>;
+            cancellation_token::control* block = cancellable_block<ANY_T>(object, std::integral_constant<bool, INLINE>());
+            if (type == key_t::copy) {
+                if (!INLINE) {
+                    node_t* copy_node = copy_object<node_t>(*reinterpret_cast<node_t*>(object));
+                    if (!copy_node) return 0;
+                    SY_CALLBACK_COUNT(deep_copies);
+                    other = reinterpret_cast<std::uintptr_t>(copy_node);
+                }
+                cancellation_token::retain(block);
+                return 1;
+            }
+            else if (type == key_t::destroy) {
+                if (!INLINE) delete_object(reinterpret_cast<node_t*>(object));
+                cancellation_token::release(block);
+            }
+            else if (type == key_t::expired && block->cancelled.load(std::memory_order_relaxed)) {
+                other = 1;                          // release_expired() keeps the callback cancelled
+                return 1;
+            }
+            else if (type == key_t::equal)
+                return block == cancellable_block<ANY_T>(other, std::integral_constant<bool, INLINE>()) &&
+                       equal_targets(cancellable_target<ANY_T>(object, std::integral_constant<bool, INLINE>()),
+                                     cancellable_target<ANY_T>(other, std::integral_constant<bool, INLINE>()));
+            else if (type == key_t::hash)
+                return reinterpret_cast<std::uintptr_t>(block) ^
+                       hash_target(cancellable_target<ANY_T>(object, std::integral_constant<bool, INLINE>()));
+            else if (type == key_t::identity) return compared_by_identity<ANY_T>::value;
+            return 0;
+        }
+        // nothing is stored any more, the callback only remembers that it was cancelled
+        // a released cancellable target: the storage keeps the hash() the callback had, so it still equals
+        // the copies of that target, and other released copies of it (see operator==)
+        static std::uintptr_t life_cancelled(key_t type, const std::uintptr_t& object, std::uintptr_t& other) {
+            if (type == key_t::equal) return object == other;
+            if (type == key_t::hash) return object;
+            return type == key_t::copy || type == key_t::expired;
+        }
+        static std::uintptr_t life_global(key_t type, const std::uintptr_t& object, std::uintptr_t& other) {
+            if (type == key_t::equal) return object == other;
+            return type == key_t::expired || type == key_t::identity ? 0 : object;
+        }
+        // every empty callback equals every other
+        static std::uintptr_t life_nothing(key_t type, const std::uintptr_t&, std::uintptr_t&) { return type == key_t::equal; }
+
+        // the same target of a functor held by value: operator== when it has one, else the bytes of one whose
+        // bytes are its value (captured pointers and integers, no padding), else only the very same object
+        template<typename T, typename = void>   struct      is_equality_comparable : std::false_type {};
+        template<typename T>                    struct      is_equality_comparable<T,
+            my_void_t<decltype(static_cast<bool>(std::declval<const T&>() == std::declval<const T&>()))>> : std::true_type {};
+        template<typename T, typename = void>   struct      is_std_hashable : std::false_type {};
+        template<typename T>                    struct      is_std_hashable<T,
+            my_void_t<decltype(static_cast<std::size_t>(std::hash<T>()(std::declval<const T&>())))>> : std::true_type {};
+        // padding bytes are indeterminate: equal objects may differ there. Before C++17 the GCC / Clang / MSVC builtin
+        template<typename T>                    struct      has_unique_bytes : std::integral_constant<bool,
+#if __cplusplus >= 201703L
+            std::has_unique_object_representations<T>::value
+#elif defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+            __has_unique_object_representations(T)
+#else
+            false
+#endif
+        > {};
+        template<typename T>                    struct      compared_by_identity : std::integral_constant<bool,
+            !is_equality_comparable<T>::value && !has_unique_bytes<T>::value> {};
+
+        template<typename T>
+        static bool equal_targets(const T* a, const T* b) {
+            return a == b || equal_values(*a, *b, is_equality_comparable<T>(), has_unique_bytes<T>());
+        }
+        template<typename T, typename BYTES>
+        static bool equal_values(const T& a, const T& b, std::true_type, BYTES) { return static_cast<bool>(a == b); }
+        template<typename T>
+        static bool equal_values(const T& a, const T& b, std::false_type, std::true_type) {
+            return std::memcmp(&a, &b, sizeof(T)) == 0;
+        }
+        template<typename T>
+        static bool equal_values(const T&, const T&, std::false_type, std::false_type) { return false; }
+        // comparable functors hash with std::hash<T> when they have one, otherwise they all hash alike
+        // and only equal_targets tells them apart: give such a functor a std::hash to keep lookups O(1)
+        template<typename T>
+        static std::uintptr_t hash_target(const T* target) {
+            return hash_value(target, is_equality_comparable<T>(), std::integral_constant<bool,
+                is_equality_comparable<T>::value ? is_std_hashable<T>::value : has_unique_bytes<T>::value>());
+        }
+        template<typename T>
+        static std::uintptr_t hash_value(const T* target, std::true_type, std::true_type) {
+            return static_cast<std::uintptr_t>(std::hash<T>()(*target));
+        }
+        template<typename T>
+        static std::uintptr_t hash_value(const T*, std::true_type, std::false_type) { return 0; }
+        template<typename T>
+        static std::uintptr_t hash_value(const T* target, std::false_type, std::true_type) {
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(target);
+            std::uint64_t hash = 14695981039346656037ull;           // FNV-1a
+            for (std::size_t i = 0; i < sizeof(T); ++i) hash = (hash ^ bytes[i]) * 1099511628211ull;
+            return static_cast<std::uintptr_t>(hash);
+        }
+        template<typename T>
+        static std::uintptr_t hash_value(const T* target, std::false_type, std::false_type) {
+            return reinterpret_cast<std::uintptr_t>(target);
         }
-        static std::uintptr_t life_nothing(key_t type, const std::uintptr_t&) { return 0; }
 #pragma endregion
 #pragma region THUNK TABLE
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) > 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) &> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const &> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile &> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile &> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) &&> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const &&> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile &&> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile &&> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
+        // one table per (invoke, life) pair, a static data member rather than a local static
+        // so the thunk functions are constexpr and callbacks can be constant-initialized
+        template<func_invoke_t INVOKE, func_life_t LIFE, bool TRIVIAL, bool EXPIRABLE = false>
+        struct static_thunk {
+            static constexpr thunk_table table = { INVOKE, LIFE, TRIVIAL, EXPIRABLE };
+        };
+
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_member() {
+            SY_CALLBACK_NAME_THUNK(&invoke_member<CLASS, MEMBER_T, FUNC>);
+            return &static_thunk<&invoke_member<CLASS, MEMBER_T, FUNC>, &life_member<typename remove_all<CLASS>::type>, true>::table;
+        }
+        template<typename CLASS, typename MEMBER_T>
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_member_runtime() {
+            SY_CALLBACK_NAME_THUNK(&invoke_member_runtime<CLASS, MEMBER_T>);
+            return &static_thunk<&invoke_member_runtime<CLASS, MEMBER_T>, &life_member_runtime<typename remove_all<CLASS>::type>,
+                                 member_record_inline>::table;
+        }
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_member_inline() {
+            SY_CALLBACK_NAME_THUNK(&invoke_member_inline<CLASS, MEMBER_T, FUNC>);
+            return &static_thunk<&invoke_member_inline<CLASS, MEMBER_T, FUNC>, &life_member_inline<CLASS>, true>::table;
+        }
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_member_tracked() {
+            SY_CALLBACK_NAME_THUNK(&invoke_member_tracked<CLASS, MEMBER_T, FUNC>);
+            return &static_thunk<&invoke_member_tracked<CLASS, MEMBER_T, FUNC>, &life_member_tracked, false, true>::table;
+        }
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_member_value() {
+            SY_CALLBACK_NAME_THUNK(&invoke_member_value<CLASS, MEMBER_T, FUNC>);
+            return &static_thunk<&invoke_member_value<CLASS, MEMBER_T, FUNC>, &life_member_value<CLASS>, false>::table;
         }
-        
-        static std::uintptr_t thunk_pointer_not_noexcept(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_pointer_not_noexcept) 
-                            : reinterpret_cast<std::uintptr_t>(&life_global);
+
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_pointer_not_noexcept() {
+            SY_CALLBACK_NAME_THUNK(&invoke_pointer_not_noexcept);
+            return &static_thunk<&invoke_pointer_not_noexcept, &life_global, true>::table;
+        }
+        template<typename RESOLVER>
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_lazy() {
+            SY_CALLBACK_NAME_THUNK(&invoke_lazy<RESOLVER>);
+            return &static_thunk<&invoke_lazy<RESOLVER>, &life_global, true>::table;
         }
 
 #if __cplusplus >= 201703L
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) & noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const & noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile & noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile & noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) && noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const && noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile && noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile && noexcept> 
-        static std::uintptr_t thunk_member(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_member<CLASS, FUNC>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_member<typename remove_all<CLASS>::type>);
-        } 
-
-        static std::uintptr_t thunk_pointer_noexcept(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_pointer_noexcept) 
-                            : reinterpret_cast<std::uintptr_t>(&life_global);
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_pointer_noexcept() {
+            SY_CALLBACK_NAME_THUNK(&invoke_pointer_noexcept);
+            return &static_thunk<&invoke_pointer_noexcept, &life_global, true>::table;
         }
 
 #endif
         template<typename ANY_T>
-        static std::uintptr_t thunk_any(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_any<ANY_T>) 
-                            : reinterpret_cast<std::uintptr_t>(&life_any<ANY_T>);
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_any() {
+            SY_CALLBACK_NAME_THUNK(&invoke_any<ANY_T>);
+            return &static_thunk<&invoke_any<ANY_T>, &life_any<ANY_T>, false>::table;
+        }
+
+        template<typename ANY_T, bool INLINE>
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_cancellable() {
+            SY_CALLBACK_NAME_THUNK(&invoke_cancellable<ANY_T, INLINE>);
+            return &static_thunk<&invoke_cancellable<ANY_T, INLINE>, &life_cancellable<ANY_T, INLINE>, false, true>::table;
+        }
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_cancelled() {
+            return &static_thunk<&invoke_cancelled, &life_cancelled, false, true>::table;
         }
 
-        static std::uintptr_t thunk_nothing(bool invoke) {
-            return invoke   ? reinterpret_cast<std::uintptr_t>(&invoke_nothing) 
-                            : reinterpret_cast<std::uintptr_t>(&life_nothing);
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_nothing() {
+            return &static_thunk<&invoke_nothing, &life_nothing, true>::table;
         }
 #pragma endregion
-    public:
-#pragma region MAKE
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) , typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;
+        // objects that fit the storage and are trivially copyable live inline (moved / swapped bitwise),
+        // everything else is owned on the heap
+        template<typename CLASS>                struct      is_inline_object {
+            static constexpr bool value =
+                std::is_trivially_copyable<CLASS>::value &&
+                sizeof(CLASS) <= sizeof(std::uintptr_t) * storage_words &&
+                alignof(CLASS) <= alignof(std::uintptr_t);
+        };
+        // a cancellable target shares the storage with the control block, so it has one word less:
+        // never inline in a one-word callback
+        template<typename ANY_T>                struct      is_cancellable_inline {
+            static constexpr bool value =
+                std::is_trivially_copyable<ANY_T>::value &&
+                sizeof(ANY_T) <= sizeof(std::uintptr_t) * (storage_words - 1) &&
+                alignof(ANY_T) <= alignof(std::uintptr_t);
+        };
+        template<typename D_ANY_T, typename ANY_T>
+        void emplace_cancellable(cancellation_token::control* block, ANY_T&& func, std::true_type) {
+            new (&_object) D_ANY_T(std::forward<ANY_T>(func));
+            _storage[storage_words - 1] = reinterpret_cast<std::uintptr_t>(block);
+        }
+        template<typename D_ANY_T, typename ANY_T>
+        void emplace_cancellable(cancellation_token::control* block, ANY_T&& func, std::false_type) {
+            _object = reinterpret_cast<std::uintptr_t>(new_object<cancellable_node<D_ANY_T>>(block, std::forward<ANY_T>(func)));
+        }
+        void emplace_member_record(const member_record& record, std::true_type) {
+            std::memcpy(_storage, &record, sizeof(record));
+        }
+        void emplace_member_record(const member_record& record, std::false_type) {
+            _object = reinterpret_cast<std::uintptr_t>(new_object<member_record>(record));
+        }
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static callback<RETURN(ARGS...), WORDS> make_member_value(CLASS&& object, std::true_type) {
+            callback<RETURN(ARGS...), WORDS> callback;
+            new (&callback._object) CLASS(std::move(object));
+            callback._thunk     = thunk_member_inline<CLASS, MEMBER_T, FUNC>();
             return callback;
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static callback<RETURN(ARGS...), WORDS> make_member_value(CLASS&& object, std::false_type) {
+            callback<RETURN(ARGS...), WORDS> callback;
+            callback._object    = reinterpret_cast<std::uintptr_t>(new (allocate_storage<CLASS>()) CLASS(std::move(object)));
+            callback._thunk     = thunk_member_value<CLASS, MEMBER_T, FUNC>();
             return callback;
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static callback<RETURN(ARGS...), WORDS> make_member_tracked(CLASS* object) {
+            static_assert(std::is_base_of<trackable, CLASS>::value, "make_tracked needs a class derived from sy_callback::trackable");
+            callback<RETURN(ARGS...), WORDS> callback;
+            callback._object    = reinterpret_cast<std::uintptr_t>(static_cast<const trackable*>(object)->track());
+            callback._thunk     = thunk_member_tracked<CLASS, MEMBER_T, FUNC>();
             return callback;
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        static callback<RETURN(ARGS...), WORDS> make_member_value(CLASS&& object) {
+            return make_member_value<CLASS, MEMBER_T, FUNC>(std::move(object), 
+                std::integral_constant<bool, is_inline_object<CLASS>::value>());
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) &, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename OBJ, typename MEMBER_T, MEMBER_T FUNC>
+        static SY_CALLBACK_CONSTEXPR20 callback<RETURN(ARGS...), WORDS> make_member(OBJ* object) {
+            return callback<RETURN(ARGS...), WORDS>(object, thunk_member<OBJ, MEMBER_T, FUNC>());
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const &, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename CLASS, typename MEMBER_T, MEMBER_T FUNC>
+        RETURN invoke_member_prediction(ARGS... args) {
+            return (_thunk == thunk_member<CLASS, MEMBER_T, FUNC>())
+                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
+                : (*_thunk->invoke)(_object, args...);
+        }
+        SY_CALLBACK_CONSTEXPR20 void destroy_target() {
+            if (!_thunk->trivial) (*_thunk->life)(key_t::destroy, _object, _object);
+        }
+        // "other" already holds a bitwise copy of the storage
+        static bool copy_target(func_thunk_t thunk, const std::uintptr_t& object, std::uintptr_t& other) {
+            return thunk->trivial || (*thunk->life)(key_t::copy, object, other) != 0;
+        }
+        // release_expired() frees the target of a cancelled callback but keeps its hash(): it still equals
+        // the cancelled copies that were not released, e.g. the one a subscriber_set holds
+        static bool released_copy(const callback& released, const callback& copy) {
+            if (released._thunk != thunk_cancelled() || !copy._thunk->expirable) return false;
+            std::uintptr_t cancelled = 0;
+            return (*copy._thunk->life)(key_t::expired, copy._object, cancelled) && cancelled &&
+                   copy.hash() == static_cast<std::size_t>(released._object);
+        }
+        // a plain function pointer is not a noexcept one: target<RETURN(*)(ARGS...) noexcept>() gives nullptr
+        template<typename POINTER>
+        static POINTER pointer_target(RETURN(*func)(ARGS...), std::true_type) { return func; }
+        template<typename POINTER>
+        static POINTER pointer_target(RETURN(*)(ARGS...), std::false_type) { return nullptr; }
+        using function_t = std::function<RETURN(ARGS...)>;
+#if defined(__cpp_lib_move_only_function)
+        using move_only_function_t = std::move_only_function<RETURN(ARGS...)>;
+#endif
+        // heap targets. A std::function of the same signature is unwrapped first: an empty one stays empty,
+        // a function pointer is stored inline and a callback that went through std::function comes back as itself
+        template<typename D_ANY_T, typename ANY_T>
+        void emplace_any(ANY_T&& func) {
+            emplace_any<D_ANY_T>(std::forward<ANY_T>(func), std::is_same<D_ANY_T, function_t>());
+        }
+        template<typename D_ANY_T, typename ANY_T>
+        void emplace_any(ANY_T&& func, std::false_type) {
+            _object = reinterpret_cast<std::uintptr_t>(new_object<D_ANY_T>(std::forward<ANY_T>(func)));
+            _thunk = thunk_any<D_ANY_T>();
+        }
+        template<typename D_ANY_T, typename ANY_T>
+        void emplace_any(ANY_T&& func, std::true_type) {
+            using inner_t = typename std::conditional<
+                std::is_lvalue_reference<ANY_T>::value || std::is_const<typename std::remove_reference<ANY_T>::type>::value,
+                const callback&, callback&&>::type;
+            _object = 0;
+            _thunk = thunk_nothing();
+            if (!func) return;
+            if (auto pointer = func.template target<RETURN(*)(ARGS...)>()) {
+                _object = reinterpret_cast<std::uintptr_t>(*pointer);
+                _thunk = thunk_pointer_not_noexcept();
+            }
+#if __cplusplus >= 201703L
+            else if (auto pointer = func.template target<RETURN(*)(ARGS...) noexcept>()) {
+                _object = reinterpret_cast<std::uintptr_t>(*pointer);
+                _thunk = thunk_pointer_noexcept();
+            }
+#endif
+            else if (auto inner = func.template target<callback>()) *this = static_cast<inner_t>(*inner);
+            else emplace_any<D_ANY_T>(std::forward<ANY_T>(func), std::false_type());
         }
+    public:
+#pragma region MAKE
+#if __cplusplus >= 201703L
+        // member bindings: the type of FUNC is deduced, so one template covers every cv / ref / noexcept
+        // qualifier and only the bindings actually used are instantiated. FUNC must name one function:
+        // an overloaded member needs a cast, static_cast<int (CLASS::*)(int) const>(&CLASS::FUNC)
+        template<typename CLASS, auto FUNC, typename OBJ>
+        static SY_CALLBACK_CONSTEXPR20 typename std::enable_if<
+                is_valid_object<CLASS, OBJ>::value &&
+                is_bindable_member<OBJ, decltype(FUNC)>::lvalue,
+        callback<RETURN(ARGS...), WORDS>>::type make(OBJ*&& object) {
+            return make_member<OBJ, decltype(FUNC), FUNC>(object);
+        }
+        // owning binding: the object is moved into the callback
+        template<typename CLASS, auto FUNC>
+        static typename std::enable_if<is_bindable_member<CLASS, decltype(FUNC)>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(CLASS object) {
+            return make_member_value<CLASS, decltype(FUNC), FUNC>(std::move(object));
+        }
+#else
+        // one entry point per qualifier: before C++17 a template parameter can't deduce its own type
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...), typename OBJ>
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...), FUNC>(object); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const, typename OBJ>
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) const, FUNC>(object); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile, typename OBJ>
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) volatile, FUNC>(object); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile, typename OBJ>
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) const volatile, FUNC>(object); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) &, typename OBJ>
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) &, FUNC>(object); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const &, typename OBJ>
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) const &, FUNC>(object); }
         template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile &, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
-        }
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) volatile &, FUNC>(object); }
         template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile &, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
-        }
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) const volatile &, FUNC>(object); }
         template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) &&, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
-        }
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) &&, FUNC>(object); }
         template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const &&, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
-        }
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) const &&, FUNC>(object); }
         template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile &&, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
-        }
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) volatile &&, FUNC>(object); }
         template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile &&, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
-        }
-        
-        template<RETURN(*FUNC)(ARGS...)>
-        static callback<RETURN(ARGS...)> make() {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(FUNC);
-            callback._thunk     = &thunk_pointer_not_noexcept;
-            return callback;
-        } 
-        static callback<RETURN(ARGS...)> make(RETURN(*func)(ARGS...)) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object = reinterpret_cast<std::uintptr_t>(func);
-            callback._thunk = &thunk_pointer_not_noexcept;
-            return callback;
-        }
+        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make(OBJ*&& object) { return make_member<OBJ, RETURN(CLASS::*)(ARGS...) const volatile &&, FUNC>(object); }
 
-        template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
+        // owning bindings
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...)>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...), FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) const, FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) volatile, FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) const volatile, FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) &>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) &, FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const &>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) const &, FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile &>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) volatile &, FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile &>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) const volatile &, FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) &&>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) &&, FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const &&>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) const &&, FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile &&>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) volatile &&, FUNC>(std::move(object)); }
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile &&>
+        static callback<RETURN(ARGS...), WORDS> make(CLASS object) { return make_member_value<CLASS, RETURN(CLASS::*)(ARGS...) const volatile &&, FUNC>(std::move(object)); }
+#endif
+
+        template<typename OBJ, typename MEMBER_T>
         static typename std::enable_if<
-                !std::is_same<D_ANY_T, callback>::value &&
-                std::is_convertible<D_ANY_T, RETURN(*)(ARGS...)>::value &&
-                is_invocable_r<ANY_T>::value,
-        callback<RETURN(ARGS...)>>::type make(ANY_T&& func) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(+func);
-            callback._thunk     = &thunk_pointer_not_noexcept;
+                std::is_member_function_pointer<MEMBER_T>::value &&
+                is_member_invocable_r<OBJ, MEMBER_T>::value,
+        callback<RETURN(ARGS...), WORDS>>::type make(OBJ* object, MEMBER_T func) {
+            static_assert(sizeof(MEMBER_T) <= sizeof(std::uintptr_t) * member_pointer_words,
+                "member function pointer is wider than member_pointer_words");
+            member_record record;
+            std::memset(&record, 0, sizeof(record));
+            record.words[0]     = reinterpret_cast<std::uintptr_t>(object);
+            std::memcpy(&record.words[1], &func, sizeof(MEMBER_T));
+            callback<RETURN(ARGS...), WORDS> callback;
+            callback.emplace_member_record(record, std::integral_constant<bool, member_record_inline>());
+            callback._thunk     = thunk_member_runtime<OBJ, MEMBER_T>();
             return callback;
         }
-        
-        static callback<RETURN(ARGS...)> make(callback<RETURN(ARGS...)>&& func) {
-            return std::forward<callback<RETURN(ARGS...)>>(func);
-        }
+
+        // tracked bindings: the object must derive from trackable, the callback turns empty when it is destroyed.
+        // a call checks one flag; destroying the object while another thread calls is not synchronized
 #if __cplusplus >= 201703L
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename CLASS, auto FUNC>
+        static typename std::enable_if<is_bindable_member<CLASS, decltype(FUNC)>::lvalue, callback<RETURN(ARGS...), WORDS>>::type
+        make_tracked(CLASS* object) {
+            return make_member_tracked<CLASS, decltype(FUNC), FUNC>(object);
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+#else
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...)>
+        static callback<RETURN(ARGS...), WORDS> make_tracked(CLASS* object) {
+            return make_member_tracked<CLASS, RETURN(CLASS::*)(ARGS...), FUNC>(object);
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const>
+        static callback<RETURN(ARGS...), WORDS> make_tracked(CLASS* object) {
+            return make_member_tracked<CLASS, RETURN(CLASS::*)(ARGS...) const, FUNC>(object);
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile>
+        static callback<RETURN(ARGS...), WORDS> make_tracked(CLASS* object) {
+            return make_member_tracked<CLASS, RETURN(CLASS::*)(ARGS...) volatile, FUNC>(object);
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) & noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile>
+        static callback<RETURN(ARGS...), WORDS> make_tracked(CLASS* object) {
+            return make_member_tracked<CLASS, RETURN(CLASS::*)(ARGS...) const volatile, FUNC>(object);
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const & noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) &>
+        static callback<RETURN(ARGS...), WORDS> make_tracked(CLASS* object) {
+            return make_member_tracked<CLASS, RETURN(CLASS::*)(ARGS...) &, FUNC>(object);
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile & noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const &>
+        static callback<RETURN(ARGS...), WORDS> make_tracked(CLASS* object) {
+            return make_member_tracked<CLASS, RETURN(CLASS::*)(ARGS...) const &, FUNC>(object);
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile & noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile &>
+        static callback<RETURN(ARGS...), WORDS> make_tracked(CLASS* object) {
+            return make_member_tracked<CLASS, RETURN(CLASS::*)(ARGS...) volatile &, FUNC>(object);
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) && noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile &>
+        static callback<RETURN(ARGS...), WORDS> make_tracked(CLASS* object) {
+            return make_member_tracked<CLASS, RETURN(CLASS::*)(ARGS...) const volatile &, FUNC>(object);
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const && noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
+#endif
+
+        // cancellable targets: a function pointer, a functor or another callback, with the token's control block.
+        // in a wide_callback, functors that are trivially copyable and fit two words (a lambda capturing this
+        // and an int) sit inline next to the block; otherwise one node holds both. After cancel() the callback is
+        // not callable: calling it does nothing for a void callback and throws std::bad_function_call otherwise.
+        // calls only read the flag, so they may race with cancel(); the target is freed on destruction,
+        // assignment or release_expired()
+        template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
+        static typename std::enable_if<is_invocable_r<ANY_T>::value, callback<RETURN(ARGS...), WORDS>>::type
+        make_cancellable(const cancellation_token& token, ANY_T&& func) {
+            callback<RETURN(ARGS...), WORDS> callback;
+            if (!token.block()) {
+                callback = std::forward<ANY_T>(func);   // a default constructed token never cancels
+                return callback;
+            }
+            constexpr bool is_inline = is_cancellable_inline<D_ANY_T>::value;
+            callback.template emplace_cancellable<D_ANY_T>(token.block(), std::forward<ANY_T>(func), std::integral_constant<bool, is_inline>());
+            cancellation_token::retain(token.block());
+            callback._thunk      = thunk_cancellable<D_ANY_T, is_inline>();
             return callback;
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) volatile && noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
+
+        // lazily bound function: nothing is resolved until the first call. Every call goes through
+        // void* RESOLVER::resolve(const void* state), which must be thread-safe and should cache the address
+        // (one acquire load once resolved). state is not owned and must outlive the callback
+        template<typename RESOLVER>
+        static callback<RETURN(ARGS...), WORDS> make_lazy(const void* state) {
+            callback<RETURN(ARGS...), WORDS> callback;
+            callback._object    = reinterpret_cast<std::uintptr_t>(state);
+            callback._thunk     = thunk_lazy<RESOLVER>();
             return callback;
         }
-        template<typename CLASS, RETURN(CLASS::*FUNC)(ARGS...) const volatile && noexcept, typename OBJ>
-        static typename std::enable_if<is_valid_object<CLASS, OBJ>::value, callback<RETURN(ARGS...)>>::type
-        make(OBJ*&& object) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(std::forward<OBJ*>(object));
-            callback._thunk     = &thunk_member<OBJ, FUNC>;;
-            return callback;
+        
+        template<RETURN(*FUNC)(ARGS...)>
+        static SY_CALLBACK_CONSTEXPR20 callback<RETURN(ARGS...), WORDS> make() {
+            return callback<RETURN(ARGS...), WORDS>(FUNC, thunk_pointer_not_noexcept());
+        } 
+        static SY_CALLBACK_CONSTEXPR20 callback<RETURN(ARGS...), WORDS> make(RETURN(*func)(ARGS...)) {
+            return callback<RETURN(ARGS...), WORDS>(func, thunk_pointer_not_noexcept());
+        }
+
+        template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
+        static SY_CALLBACK_CONSTEXPR20 typename std::enable_if<
+                !std::is_same<D_ANY_T, callback>::value &&
+                std::is_convertible<D_ANY_T, RETURN(*)(ARGS...)>::value &&
+                is_invocable_r<ANY_T>::value,
+        callback<RETURN(ARGS...), WORDS>>::type make(ANY_T&& func) {
+            return callback<RETURN(ARGS...), WORDS>(+func, thunk_pointer_not_noexcept());
         }
         
+        static callback<RETURN(ARGS...), WORDS> make(callback<RETURN(ARGS...), WORDS>&& func) {
+            return std::forward<callback<RETURN(ARGS...), WORDS>>(func);
+        }
+#if __cplusplus >= 201703L
         template<RETURN(*FUNC)(ARGS...) noexcept>
-        static callback<RETURN(ARGS...)> make() {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(FUNC);
-            callback._thunk     = &thunk_pointer_noexcept;
-            return callback;
+        static SY_CALLBACK_CONSTEXPR20 callback<RETURN(ARGS...), WORDS> make() {
+            return callback<RETURN(ARGS...), WORDS>(FUNC, thunk_pointer_noexcept());
         } 
-        static callback<RETURN(ARGS...)> make(RETURN(*func)(ARGS...) noexcept) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(func);
-            callback._thunk     = &thunk_pointer_noexcept;
-            return callback;
+        static SY_CALLBACK_CONSTEXPR20 callback<RETURN(ARGS...), WORDS> make(RETURN(*func)(ARGS...) noexcept) {
+            return callback<RETURN(ARGS...), WORDS>(func, thunk_pointer_noexcept());
         }
 
         template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
@@ -625,23 +1476,19 @@ namespace sy_callback {
                 !std::is_convertible<D_ANY_T, RETURN(*)(ARGS...)>::value &&
                 !std::is_convertible<D_ANY_T, RETURN(*)(ARGS...) noexcept>::value &&
                 is_invocable_r<ANY_T>::value,
-        callback<RETURN(ARGS...)>>::type make(ANY_T&& func) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(new D_ANY_T(std::forward<ANY_T>(func)));
-            callback._thunk     = &thunk_any<D_ANY_T>;
+        callback<RETURN(ARGS...), WORDS>>::type make(ANY_T&& func) {
+            callback<RETURN(ARGS...), WORDS> callback;
+            callback.template emplace_any<D_ANY_T>(std::forward<ANY_T>(func));
             return callback;
         }
 
         template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
-        static typename std::enable_if<
+        static SY_CALLBACK_CONSTEXPR20 typename std::enable_if<
                 !std::is_same<D_ANY_T, callback>::value &&
                 std::is_convertible<D_ANY_T, RETURN(*)(ARGS...) noexcept>::value &&
                 is_invocable_r<ANY_T>::value,
-        callback<RETURN(ARGS...)>>::type make(ANY_T&& func) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(+func);
-            callback._thunk     = &thunk_pointer_noexcept;
-            return callback;
+        callback<RETURN(ARGS...), WORDS>>::type make(ANY_T&& func) {
+            return callback<RETURN(ARGS...), WORDS>(+func, thunk_pointer_noexcept());
         }
 #elif __cplusplus >= 201103L
         template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
@@ -649,40 +1496,38 @@ namespace sy_callback {
                 !std::is_same<D_ANY_T, callback>::value &&
                 !std::is_convertible<D_ANY_T, RETURN(*)(ARGS...)>::value &&
                 is_invocable_r<ANY_T>::value,
-        callback<RETURN(ARGS...)>>::type make(ANY_T&& func) {
-            callback<RETURN(ARGS...)> callback;
-            callback._object    = reinterpret_cast<std::uintptr_t>(new D_ANY_T(std::forward<ANY_T>(func)));
-            callback._thunk     = &thunk_any<D_ANY_T>;
+        callback<RETURN(ARGS...), WORDS>>::type make(ANY_T&& func) {
+            callback<RETURN(ARGS...), WORDS> callback;
+            callback.template emplace_any<D_ANY_T>(std::forward<ANY_T>(func));
             return callback;
         }
 #endif
 #pragma endregion 
 #pragma region CONSTRUCTOR
-        callback() noexcept : _object(0), _thunk(&thunk_nothing){}
+        constexpr callback() noexcept : _object(0), _thunk(thunk_nothing()){}
         callback(const callback& other) {
-            if (other._thunk == &thunk_nothing) {
+            if (other._thunk == thunk_nothing()) {
                 _object = 0;
-                _thunk = &thunk_nothing;
+                _thunk = thunk_nothing();
                 return;
             }
 
-            std::uintptr_t object = (*reinterpret_cast<func_life_t>(other._thunk(false)))(key_t::copy, other._object);
-
-            if(!object) {
+            std::memcpy(_storage, other._storage, sizeof(_storage));
+            if(!copy_target(other._thunk, other._object, _object)) {
                 _object = 0;
-                _thunk = &thunk_nothing;
+                _thunk = thunk_nothing();
                 return;
             }
 
-            _object = object;
             _thunk = other._thunk;
         }
         callback(callback&& other) noexcept {
-            _object = other._object;
+            SY_CALLBACK_COUNT(moves);
+            std::memcpy(_storage, other._storage, sizeof(_storage));
             _thunk = other._thunk;
 
             other._object = 0;
-            other._thunk = &thunk_nothing;
+            other._thunk = thunk_nothing();
         }
         template<
             typename ANY_T,
@@ -694,14 +1539,8 @@ namespace sy_callback {
                 int
             >::type = 0
         >
-        callback(ANY_T&& func) {
-            _object = reinterpret_cast<std::uintptr_t>(+func);
-            _thunk = &thunk_pointer_not_noexcept;
-        }
-        callback(RETURN(*func)(ARGS...)) {
-            _object = reinterpret_cast<std::uintptr_t>(func);
-            _thunk = &thunk_pointer_not_noexcept;
-        }  
+        constexpr callback(ANY_T&& func) : _function(+func), _thunk(thunk_pointer_not_noexcept()) {}
+        constexpr callback(RETURN(*func)(ARGS...)) : _function(func), _thunk(thunk_pointer_not_noexcept()) {}
 #if __cplusplus >= 201703L
         template<
             typename ANY_T,
@@ -713,10 +1552,7 @@ namespace sy_callback {
                 int
             >::type = 0
         >
-        callback(ANY_T&& func) {
-            _object = reinterpret_cast<std::uintptr_t>(+func);
-            _thunk = &thunk_pointer_noexcept;
-        }
+        constexpr callback(ANY_T&& func) : _function(+func), _thunk(thunk_pointer_noexcept()) {}
         template<
             typename ANY_T,
             typename D_ANY_T = typename std::decay<ANY_T>::type,
@@ -729,15 +1565,9 @@ namespace sy_callback {
             >::type = 0
         >
         callback(ANY_T&& func) {
-            _object = reinterpret_cast<std::uintptr_t>(
-                new D_ANY_T(std::forward<ANY_T>(func))
-            );
-            _thunk = &thunk_any<D_ANY_T>;
+            emplace_any<D_ANY_T>(std::forward<ANY_T>(func));
         }
-        callback(RETURN(*func)(ARGS...) noexcept) {
-            _object = reinterpret_cast<std::uintptr_t>(func);
-            _thunk = &thunk_pointer_noexcept;
-        } 
+        constexpr callback(RETURN(*func)(ARGS...) noexcept) : _function(func), _thunk(thunk_pointer_noexcept()) {}
 #elif __cplusplus >= 201103L
         template<
             typename ANY_T,
@@ -750,19 +1580,21 @@ namespace sy_callback {
             >::type = 0
         >
         callback(ANY_T&& func) {
-            _object = reinterpret_cast<std::uintptr_t>(
-                new D_ANY_T(std::forward<ANY_T>(func))
-            );
-            _thunk = &thunk_any<D_ANY_T>;
+            emplace_any<D_ANY_T>(std::forward<ANY_T>(func));
         }
 
 #endif
-        ~callback() { 
-            if(_thunk == &thunk_nothing) return;
+        SY_CALLBACK_CONSTEXPR20 ~callback() { 
+#if __cplusplus >= 202002L
+            // only trivial targets are built at compile time, and some builds (ASan) cannot compare thunk addresses there
+            if (std::is_constant_evaluated()) return;
+#endif
+            if(_thunk == thunk_nothing()) return;
 
-            (*reinterpret_cast<func_life_t>(_thunk(false)))(key_t::destroy, _object);
+            SY_CALLBACK_COUNT(destroys);
+            destroy_target();
             _object = 0;
-            _thunk = &thunk_nothing;
+            _thunk = thunk_nothing();
         }
 #pragma endregion
 #pragma region COPY_MOVE_ASSIGN_TARGET
@@ -773,10 +1605,11 @@ namespace sy_callback {
                     is_invocable_r<ANY_T>::value
                 >::type>
         ANY_T target() {
-            if (_thunk == &thunk_pointer_not_noexcept)
-                return reinterpret_cast<RETURN(*)(ARGS...)>(_object);
+            if (_thunk == thunk_pointer_not_noexcept())
+                return pointer_target<ANY_T>(reinterpret_cast<RETURN(*)(ARGS...)>(_object),
+                    std::is_convertible<RETURN(*)(ARGS...), ANY_T>());
         #if __cplusplus >= 201703L
-            else if (_thunk == &thunk_pointer_noexcept)
+            else if (_thunk == thunk_pointer_noexcept())
                 return reinterpret_cast<RETURN(*)(ARGS...) noexcept>(_object);
         #endif
             return nullptr;
@@ -788,7 +1621,7 @@ namespace sy_callback {
                     is_invocable_r<ANY_T>::value
                 >::type>
         ANY_T* target() {
-            if (_thunk == &thunk_any<ANY_T>)
+            if (_thunk == thunk_any<ANY_T>())
                 return reinterpret_cast<ANY_T*>(_object);
             return nullptr;
         }
@@ -800,9 +1633,16 @@ namespace sy_callback {
         >
         target_func<CLASS> target() {
             std::type_index type = typeid(typename remove_all<CLASS>::type);
-            if (&life_member<typename remove_all<CLASS>::type> == reinterpret_cast<func_life_t>(_thunk(false))) 
-                return target_func<CLASS>(_object, _thunk);
-            return target_func<CLASS>(0, &thunk_nothing);
+            func_life_t life = _thunk->life;
+            // an object owned as const is only reachable through target<const CLASS>()
+            if (&life_member<typename remove_all<CLASS>::type> == life ||
+                &life_member_value<typename remove_all<CLASS>::type> == life || &life_member_value<CLASS> == life) 
+                return target_func<CLASS>(&_object, reinterpret_cast<CLASS*>(_object), _thunk);
+            if (&life_member_runtime<typename remove_all<CLASS>::type> == life)
+                return target_func<CLASS>(&_object, reinterpret_cast<CLASS*>(member_binding(_object)[0]), _thunk);
+            if (&life_member_inline<typename remove_all<CLASS>::type> == life || &life_member_inline<CLASS> == life) 
+                return target_func<CLASS>(&_object, reinterpret_cast<CLASS*>(&_object), _thunk);
+            return target_func<CLASS>(nullptr, nullptr, thunk_nothing());
         }
 
         template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
@@ -811,49 +1651,55 @@ namespace sy_callback {
             is_invocable_r<ANY_T>::value,
         callback&>::type
         operator=(ANY_T&& func) {
-            if(_thunk != &thunk_nothing){
-                (*reinterpret_cast<func_life_t>(_thunk(false)))(key_t::destroy, _object);
+            if(_thunk != thunk_nothing()){
+                SY_CALLBACK_COUNT(destroys);
+                destroy_target();
             }
 
-            _object = reinterpret_cast<std::uintptr_t>(new D_ANY_T(std::forward<ANY_T>(func)));
-            _thunk = &thunk_any<D_ANY_T>;
+            emplace_any<D_ANY_T>(std::forward<ANY_T>(func));
             return *this;
         }
 
         callback& operator=(RETURN(*func)(ARGS...)) {
-            if(_thunk != &thunk_nothing){
-                (*reinterpret_cast<func_life_t>(_thunk(false)))(key_t::destroy, _object);
+            if(_thunk != thunk_nothing()){
+                SY_CALLBACK_COUNT(destroys);
+                destroy_target();
             }
 
             _object = reinterpret_cast<std::uintptr_t>(func);
-            _thunk = &thunk_pointer_not_noexcept;
+            _thunk = thunk_pointer_not_noexcept();
             return *this;
         }
 
 #if __cplusplus >= 201703L
         callback& operator=(RETURN(*func)(ARGS...) noexcept) {
-            if(_thunk != &thunk_nothing){
-                (*reinterpret_cast<func_life_t>(_thunk(false)))(key_t::destroy, _object);
+            if(_thunk != thunk_nothing()){
+                SY_CALLBACK_COUNT(destroys);
+                destroy_target();
             }
 
             _object = reinterpret_cast<std::uintptr_t>(func);
-            _thunk = &thunk_pointer_noexcept;
+            _thunk = thunk_pointer_noexcept();
             return *this;
         }
 #endif
 
         callback& operator=(const callback& other) {
-            if (this == &other || other._thunk == &thunk_nothing) return *this;
-
-            std::uintptr_t object = (*reinterpret_cast<func_life_t>(other._thunk(false)))(key_t::copy, other._object);
+            if (this == &other) return *this;
+            if (other._thunk == thunk_nothing()) {
+                reset();
+                return *this;
+            }
 
-            if(!object) {
-                _object = 0;
-                _thunk = &thunk_nothing;
+            std::uintptr_t storage[storage_words];
+            std::memcpy(storage, other._storage, sizeof(storage));
+            if(!copy_target(other._thunk, other._object, storage[0])) {
+                reset();
                 return *this;
             }
             
-            _object = object;
+            reset();
+            std::memcpy(_storage, storage, sizeof(storage));
             _thunk = other._thunk;
 
             return *this;
@@ -861,92 +1707,78 @@ namespace sy_callback {
 
         callback& operator=(callback&& other) noexcept {
             if (this != &other) {
-                if(_thunk != &thunk_nothing){
-                    (*reinterpret_cast<func_life_t>(_thunk(false)))(key_t::destroy, _object);
+                SY_CALLBACK_COUNT(moves);
+                if(_thunk != thunk_nothing()){
+                    SY_CALLBACK_COUNT(destroys);
+                    destroy_target();
                 }
 
-                _object = other._object;
+                std::memcpy(_storage, other._storage, sizeof(_storage));
                 _thunk = other._thunk;
 
                 other._object = 0;
-                other._thunk = &thunk_nothing;
+                other._thunk = thunk_nothing();
             }
             return *this;
         }
 #pragma endregion
 #pragma region INVOKE PREDICTION
-                template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) > 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+#if __cplusplus >= 201703L
+        template<typename CLASS, auto FUNC>
+        typename std::enable_if<is_bindable_member<CLASS, decltype(FUNC)>::lvalue, RETURN>::type
+        invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, decltype(FUNC), FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+#else
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...)>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...), FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) const, FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) volatile, FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) &> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) const volatile, FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const &> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) &>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) &, FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile &> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const &>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) const &, FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile &> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile &>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) volatile &, FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) &&> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile &>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) const volatile &, FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const &&> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) &&>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) &&, FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile &&> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const &&>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) const &&, FUNC>(args...);
         }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile &&> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>)
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile &&>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) volatile &&, FUNC>(args...);
         }
+        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile &&>
+        RETURN invoke_prediction(ARGS... args) {
+            return invoke_member_prediction<CLASS, RETURN(remove_all<CLASS>::type::*)(ARGS...) const volatile &&, FUNC>(args...);
+        }
+#endif
 
         template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
         typename std::enable_if<
@@ -954,89 +1786,16 @@ namespace sy_callback {
                 std::is_convertible<D_ANY_T, RETURN(*)(ARGS...)>::value &&
                 is_invocable_r<ANY_T>::value, RETURN>::type
         invoke_prediction(ARGS... args){
-            return _thunk == &thunk_pointer_not_noexcept
+            return _thunk == thunk_pointer_not_noexcept()
                 ? (*reinterpret_cast<RETURN(*)(ARGS...)>(_object))(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+                : (*_thunk->invoke)(_object, args...);
         }
 
 #if __cplusplus >= 201703L
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) & noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const & noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile & noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile & noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) && noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const && noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) volatile && noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        template<typename CLASS, RETURN(remove_all<CLASS>::type::*FUNC)(ARGS...) const volatile && noexcept> 
-        RETURN invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_member<CLASS, FUNC>) 
-                ? (reinterpret_cast<CLASS*>(_object)->*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
-        }
-        
         RETURN invoke_prediction(RETURN(*FUNC)(ARGS...) noexcept, ARGS... args){
-            return _thunk == &thunk_pointer_noexcept 
+            return _thunk == thunk_pointer_noexcept() 
                 ? (*FUNC)(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+                : (*_thunk->invoke)(_object, args...);
         }
         
         template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
@@ -1045,9 +1804,9 @@ namespace sy_callback {
                 std::is_convertible<D_ANY_T, RETURN(*)(ARGS...) noexcept>::value &&
                 is_invocable_r<ANY_T>::value, RETURN>::type
         invoke_prediction(ARGS... args){
-            return _thunk == &thunk_pointer_noexcept
+            return _thunk == thunk_pointer_noexcept()
                 ? (*reinterpret_cast<RETURN(*)(ARGS...) noexcept>(_object))(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+                : (*_thunk->invoke)(_object, args...);
         }
         template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
         typename std::enable_if<
@@ -1056,9 +1815,9 @@ namespace sy_callback {
                 !std::is_convertible<D_ANY_T, RETURN(*)(ARGS...) noexcept>::value &&
                 is_invocable_r<ANY_T>::value, RETURN>::type
         invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_any<ANY_T>)
+            return (_thunk == thunk_any<ANY_T>())
                 ? (*reinterpret_cast<ANY_T*>(_object))(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+                : (*_thunk->invoke)(_object, args...);
         }
 #elif __cplusplus >= 201103L
         template<typename ANY_T, typename D_ANY_T = typename std::decay<ANY_T>::type>
@@ -1067,33 +1826,323 @@ namespace sy_callback {
                 !std::is_convertible<D_ANY_T, RETURN(*)(ARGS...)>::value &&
                 is_invocable_r<ANY_T>::value, RETURN>::type
         invoke_prediction(ARGS... args){
-            return (_thunk == &thunk_any<ANY_T>)
+            return (_thunk == thunk_any<ANY_T>())
                 ? (*reinterpret_cast<ANY_T*>(_object))(args...)
-                : (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+                : (*_thunk->invoke)(_object, args...);
         }
 #endif
-#pragma endregion      
-        inline bool isCallable() const { return _thunk != &thunk_nothing; }
-        inline operator bool() const { return _thunk != &thunk_nothing; }
+#pragma endregion
+#pragma region STD FUNCTION
+        // back to std::function: a function pointer or a std::function held by this callback is handed back
+        // as is (moved out of an rvalue callback), anything else is wrapped once
+        function_t to_function() const& {
+            if (_thunk == thunk_nothing()) return nullptr;
+            if (_thunk == thunk_any<function_t>()) return *reinterpret_cast<const function_t*>(_object);
+            if (_thunk == thunk_pointer_not_noexcept()) return reinterpret_cast<RETURN(*)(ARGS...)>(_object);
+        #if __cplusplus >= 201703L
+            if (_thunk == thunk_pointer_noexcept()) return reinterpret_cast<RETURN(*)(ARGS...) noexcept>(_object);
+        #endif
+            return function_t(*this);
+        }
+        function_t to_function() && {
+            if (_thunk == thunk_any<function_t>()) {
+                function_t func(std::move(*reinterpret_cast<function_t*>(_object)));
+                reset();
+                return func;
+            }
+            if (_thunk->trivial) return static_cast<const callback&>(*this).to_function();
+            return function_t(std::move(*this));
+        }
+#if defined(__cpp_lib_move_only_function)
+        // std::move_only_function has no target(), so only this direction unwraps: a move_only_function or
+        // std::function held by this callback is moved out, a function pointer is passed as is
+        move_only_function_t to_move_only_function() && {
+            if (_thunk == thunk_nothing()) return nullptr;
+            if (_thunk == thunk_pointer_not_noexcept()) return reinterpret_cast<RETURN(*)(ARGS...)>(_object);
+            if (_thunk == thunk_pointer_noexcept()) return reinterpret_cast<RETURN(*)(ARGS...) noexcept>(_object);
+            move_only_function_t func;
+            if (_thunk == thunk_any<move_only_function_t>())
+                func = std::move(*reinterpret_cast<move_only_function_t*>(_object));
+            else if (_thunk == thunk_any<function_t>())
+                func = std::move(*reinterpret_cast<function_t*>(_object));
+            else return move_only_function_t(std::move(*this));
+            reset();
+            return func;
+        }
+        move_only_function_t to_move_only_function() const& { return callback(*this).to_move_only_function(); }
+#endif
+#pragma endregion
+        inline bool isCallable() const { 
+            if (_thunk == thunk_nothing()) return false;
+            if (!_thunk->expirable) return true;
+            std::uintptr_t unused = 0;
+            return !(*_thunk->life)(key_t::expired, _object, unused);
+        }
+        inline operator bool() const { return isCallable(); }
+
+        // the same kind of target (the same thunk) and the same target: the same function, the same object
+        // and member function, or equal functors (see equal_targets). Empty callbacks are equal, and a cancelled
+        // callback after release_expired() equals the cancelled copies of its target
+        bool operator==(const callback& other) const {
+            if (_thunk != other._thunk) return released_copy(*this, other) || released_copy(other, *this);
+            return (*_thunk->life)(key_t::equal, _object, const_cast<std::uintptr_t&>(other._object)) != 0;
+        }
+        bool operator!=(const callback& other) const { return !(*this == other); }
+        // false when the target only equals itself (a functor with no operator== whose bytes are not its value):
+        // no other callback, not even a copy, compares equal to this one
+        bool comparable() const {
+            std::uintptr_t unused = 0;
+            return !(*_thunk->life)(key_t::identity, _object, unused);
+        }
+        // consistent with operator==, mixed so that the low bits can index a table
+        std::size_t hash() const {
+            if (_thunk == thunk_cancelled()) return static_cast<std::size_t>(_object);
+            std::uintptr_t unused = 0;
+            std::uint64_t hash = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(_thunk)) * 0x9E3779B97F4A7C15ull;
+            hash ^= static_cast<std::uint64_t>((*_thunk->life)(key_t::hash, _object, unused));
+            hash = (hash ^ (hash >> 31)) * 0xBF58476D1CE4E5B9ull;
+            return static_cast<std::size_t>(hash ^ (hash >> 29));
+        }
 
         inline RETURN invoke(ARGS... args) const { 
-            return (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+            return (*_thunk->invoke)(_object, args...);
         }
         inline RETURN operator()(ARGS... args) const {
-            return (*reinterpret_cast<func_invoke_t>(_thunk(true)))(_object, args...);
+            return (*_thunk->invoke)(_object, args...);
         }
         
         void swap(callback& other) {
+            std::swap(_storage, other._storage);
+            std::swap(_thunk, other._thunk);
+        }
+        void reset() {
+            if(_thunk == thunk_nothing()) return;
+
+            SY_CALLBACK_COUNT(destroys);
+            destroy_target();
+            _object = 0;
+            _thunk = thunk_nothing();
+        }
+        // frees what an expired callback still holds: the target of a cancelled one, the control block of a
+        // tracked binding whose object is gone. Calls and isCallable() only observe expiry, they never free.
+        // a cancelled callback stays cancelled and keeps its hash(), any other becomes empty.
+        // Returns false if nothing was released
+        bool release_expired() {
+            std::uintptr_t cancelled = 0;
+            if (_thunk == thunk_nothing() || _thunk == thunk_cancelled() || !_thunk->expirable ||
+                !(*_thunk->life)(key_t::expired, _object, cancelled)) return false;
+            std::size_t identity = hash();
+            reset();
+            if (cancelled) {
+                _thunk = thunk_cancelled();
+                _object = static_cast<std::uintptr_t>(identity);
+            }
+            return true;
+        }
+    };
+
+#if __cplusplus < 201703L
+    // static constexpr data members still need a definition before C++17
+    template<typename RETURN, typename... ARGS, std::size_t WORDS>
+    template<typename callback<RETURN(ARGS...), WORDS>::func_invoke_t INVOKE, typename callback<RETURN(ARGS...), WORDS>::func_life_t LIFE, bool TRIVIAL, bool EXPIRABLE>
+    constexpr typename callback<RETURN(ARGS...), WORDS>::thunk_table callback<RETURN(ARGS...), WORDS>::template static_thunk<INVOKE, LIFE, TRIVIAL, EXPIRABLE>::table;
+#endif
+
+    // the invoke function of one signature in a multi_callback thunk table, INDEX keeps the bases distinct
+    template<std::size_t INDEX, typename SIGNATURE> struct multi_thunk_entry;
+    template<std::size_t INDEX, typename RETURN, typename... ARGS>
+    struct multi_thunk_entry<INDEX, RETURN(ARGS...)> {
+        RETURN(*invoke)(const std::uintptr_t&, ARGS...);
+    };
+    template<std::size_t INDEX, typename... SIGNATURES>
+    struct multi_thunk_entries {
+        constexpr multi_thunk_entries() {}
+    };
+    template<std::size_t INDEX, typename SIGNATURE, typename... SIGNATURES>
+    struct multi_thunk_entries<INDEX, SIGNATURE, SIGNATURES...>
+        : multi_thunk_entry<INDEX, SIGNATURE>, multi_thunk_entries<INDEX + 1, SIGNATURES...> {
+        template<typename FIRST, typename... REST>
+        constexpr multi_thunk_entries(FIRST first, REST... rest)
+            : multi_thunk_entry<INDEX, SIGNATURE>{ first }, multi_thunk_entries<INDEX + 1, SIGNATURES...>(rest...) {}
+    };
+
+    template<typename DERIVED, std::size_t INDEX, typename SIGNATURE, typename... SIGNATURES> class multi_invoker;
+    template<typename DERIVED, std::size_t INDEX, typename RETURN, typename... ARGS>
+    class multi_invoker<DERIVED, INDEX, RETURN(ARGS...)> {
+    public:
+        inline RETURN operator()(ARGS... args) const {
+            const DERIVED& self = static_cast<const DERIVED&>(*this);
+            return (*static_cast<const multi_thunk_entry<INDEX, RETURN(ARGS...)>&>(*self._thunk).invoke)(self._object, args...);
+        }
+    };
+    template<typename DERIVED, std::size_t INDEX, typename RETURN, typename... ARGS, typename NEXT, typename... SIGNATURES>
+    class multi_invoker<DERIVED, INDEX, RETURN(ARGS...), NEXT, SIGNATURES...> 
+        : public multi_invoker<DERIVED, INDEX + 1, NEXT, SIGNATURES...> {
+    public:
+        using multi_invoker<DERIVED, INDEX + 1, NEXT, SIGNATURES...>::operator();
+        inline RETURN operator()(ARGS... args) const {
+            const DERIVED& self = static_cast<const DERIVED&>(*this);
+            return (*static_cast<const multi_thunk_entry<INDEX, RETURN(ARGS...)>&>(*self._thunk).invoke)(self._object, args...);
+        }
+    };
+
+    // one stored object, one thunk table: the life function and the invoke function of each signature
+    template<typename SIGNATURE, typename... SIGNATURES>
+    class multi_callback<SIGNATURE, SIGNATURES...> 
+        : public multi_invoker<multi_callback<SIGNATURE, SIGNATURES...>, 1, SIGNATURE, SIGNATURES...> {
+        template<typename, std::size_t, typename, typename...> friend class multi_invoker;
+
+        using base_t = multi_invoker<multi_callback<SIGNATURE, SIGNATURES...>, 1, SIGNATURE, SIGNATURES...>;
+        using key_t = typename callback<SIGNATURE>::key_t;
+        using func_life_t = typename callback<SIGNATURE>::func_life_t;
+        using entries_t = multi_thunk_entries<1, SIGNATURE, SIGNATURES...>;
+
+        struct thunk_table : entries_t {
+            func_life_t life;
+
+            template<typename... INVOKES>
+            constexpr thunk_table(func_life_t l, INVOKES... invokes) : entries_t(invokes...), life(l) {}
+        };
+        using func_thunk_t = const thunk_table*;
+
+        template<typename F, typename SIG>      struct      is_invocable_r;
+        template<typename F, typename RETURN, typename... ARGS>
+                                                struct      is_invocable_r<F, RETURN(ARGS...)> {
+        private:
+            template<typename U>
+            static auto test(int) -> typename std::is_convertible<
+                decltype(std::declval<U&>()(std::declval<ARGS>()...)),
+                RETURN
+            >::type;
+
+            template<typename>
+            static std::false_type test(...);
+
+        public:
+            static constexpr bool value = decltype(test<F>(0))::value;
+        };
+        template<typename F, typename... SIGS>  struct      is_invocable_all : std::true_type {};
+        template<typename F, typename SIG, typename... SIGS>
+                                                struct      is_invocable_all<F, SIG, SIGS...> {
+            static constexpr bool value = is_invocable_r<F, SIG>::value && is_invocable_all<F, SIGS...>::value;
+        };
+
+        std::uintptr_t _object;
+        func_thunk_t _thunk;
+
+        // one table per stored type, a static data member like callback::static_thunk:
+        // a call is one load from the table and one indirect jump
+        template<typename ANY_T>
+        struct static_thunk {
+            static constexpr thunk_table table = { &callback<SIGNATURE>::template life_any<ANY_T>,
+                &callback<SIGNATURE>::template invoke_any<ANY_T>, &callback<SIGNATURES>::template invoke_any<ANY_T>... };
+        };
+        struct empty_thunk {
+            static constexpr thunk_table table = { &callback<SIGNATURE>::life_nothing,
+                &callback<SIGNATURE>::invoke_nothing, &callback<SIGNATURES>::invoke_nothing... };
+        };
+
+        template<typename ANY_T>
+        static SY_CALLBACK_THUNK_CONSTEXPR func_thunk_t thunk_any() {
+#ifdef SY_CALLBACK_THUNK_NAMES
+            static const std::uintptr_t invokes[] = {
+                reinterpret_cast<std::uintptr_t>(&callback<SIGNATURE>::template invoke_any<ANY_T>),
+                reinterpret_cast<std::uintptr_t>(&callback<SIGNATURES>::template invoke_any<ANY_T>)...
+            };
+            static const bool thunk_named = add_thunk_names(invokes, sizeof...(SIGNATURES) + 1, SY_CALLBACK_PRETTY_FUNCTION);
+            (void)thunk_named;
+#endif
+            return &static_thunk<ANY_T>::table;
+        }
+        static constexpr func_thunk_t thunk_nothing() { return &empty_thunk::table; }
+    public:
+        using base_t::operator();
+
+        multi_callback() noexcept : _object(0), _thunk(thunk_nothing()) {}
+        multi_callback(const multi_callback& other) : _object(other._object), _thunk(other._thunk) {
+            if (_thunk == thunk_nothing()) return;
+
+            if (!(*other._thunk->life)(key_t::copy, other._object, _object)) {
+                _object = 0;
+                _thunk = thunk_nothing();
+            }
+        }
+        multi_callback(multi_callback&& other) noexcept : _object(other._object), _thunk(other._thunk) {
+            SY_CALLBACK_COUNT(moves);
+            other._object = 0;
+            other._thunk = thunk_nothing();
+        }
+        template<
+            typename ANY_T,
+            typename D_ANY_T = typename std::decay<ANY_T>::type,
+            typename std::enable_if<
+                !std::is_same<D_ANY_T, multi_callback>::value &&
+                is_invocable_all<D_ANY_T, SIGNATURE, SIGNATURES...>::value,
+                int
+            >::type = 0
+        >
+        multi_callback(ANY_T&& func) {
+            _object = reinterpret_cast<std::uintptr_t>(new_object<D_ANY_T>(std::forward<ANY_T>(func)));
+            _thunk = thunk_any<D_ANY_T>();
+        }
+        ~multi_callback() { reset(); }
+
+        multi_callback& operator=(const multi_callback& other) {
+            if (this != &other) multi_callback(other).swap(*this);
+            return *this;
+        }
+        multi_callback& operator=(multi_callback&& other) noexcept {
+            if (this != &other) {
+                SY_CALLBACK_COUNT(moves);
+                reset();
+                _object = other._object;
+                _thunk = other._thunk;
+
+                other._object = 0;
+                other._thunk = thunk_nothing();
+            }
+            return *this;
+        }
+
+        template<typename ANY_T,
+                typename = typename std::enable_if<!std::is_pointer<ANY_T>::value>::type>
+        ANY_T* target() {
+            if (_thunk == thunk_any<ANY_T>())
+                return reinterpret_cast<ANY_T*>(_object);
+            return nullptr;
+        }
+
+        inline bool isCallable() const { return _thunk != thunk_nothing(); }
+        inline operator bool() const { return _thunk != thunk_nothing(); }
+
+        void swap(multi_callback& other) {
             std::swap(_object, other._object);
             std::swap(_thunk, other._thunk);
         }
         void reset() {
-            if(_thunk == &thunk_nothing) return;
+            if(_thunk == thunk_nothing()) return;
 
-            (*reinterpret_cast<func_life_t>(_thunk(false)))(key_t::destroy, _object);
+            SY_CALLBACK_COUNT(destroys);
+            (*_thunk->life)(key_t::destroy, _object, _object);
             _object = 0;
-            _thunk = &thunk_nothing;
+            _thunk = thunk_nothing();
         }
     };
+
+#if __cplusplus < 201703L
+    template<typename SIGNATURE, typename... SIGNATURES>
+    template<typename ANY_T>
+    constexpr typename multi_callback<SIGNATURE, SIGNATURES...>::thunk_table multi_callback<SIGNATURE, SIGNATURES...>::template static_thunk<ANY_T>::table;
+    template<typename SIGNATURE, typename... SIGNATURES>
+    constexpr typename multi_callback<SIGNATURE, SIGNATURES...>::thunk_table multi_callback<SIGNATURE, SIGNATURES...>::empty_thunk::table;
+#endif
+}
+
+// unordered containers of callbacks, see callback::hash()
+namespace std {
+    template<typename RETURN, typename... ARGS, std::size_t WORDS>
+    struct hash<sy_callback::callback<RETURN(ARGS...), WORDS>> {
+        std::size_t operator()(const sy_callback::callback<RETURN(ARGS...), WORDS>& callback) const { return callback.hash(); }
+    };
 }
 #endif
@@ -0,0 +1,209 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_COALESCE_HPP
+#define SY_COALESCE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include "sy_callback.hpp"
+
+namespace sy_callback {
+    namespace coalesce_detail {
+        template<std::size_t... I> struct indices {};
+        template<std::size_t N, std::size_t... I> struct make_indices : make_indices<N - 1, N - 1, I...> {};
+        template<std::size_t... I> struct make_indices<0, I...> { using type = indices<I...>; };
+
+        // the arguments of the last post, stored by value inside the adapter
+        template<typename... ARGS>
+        struct pending_args {
+            std::tuple<typename std::decay<ARGS>::type...> values;
+
+            void store(ARGS... args) { values = std::tuple<typename std::decay<ARGS>::type...>(args...); }
+            void call(const callback<void(ARGS...)>& target) const {
+                call(target, typename make_indices<sizeof...(ARGS)>::type());
+            }
+            template<std::size_t... I>
+            void call(const callback<void(ARGS...)>& target, indices<I...>) const { target(std::get<I>(values)...); }
+        };
+    }
+
+    // latest value wins: post keeps only the last arguments, flush delivers them once
+    template<typename SIGNATURE> class latest;
+    template<typename... ARGS>
+    class latest<void(ARGS...)> {
+        callback<void(ARGS...)> _target;
+        coalesce_detail::pending_args<ARGS...> _pending;
+        bool _dirty;
+    public:
+        explicit latest(callback<void(ARGS...)> target) : _target(std::move(target)), _dirty(false) {}
+
+        void post(ARGS... args) {
+            _pending.store(args...);
+            _dirty = true;
+        }
+        // false when nothing was posted since the last flush
+        bool flush() {
+            if (!_dirty) return false;
+            _dirty = false;
+            _pending.call(_target);
+            return true;
+        }
+        bool pending() const { return _dirty; }
+        void cancel() { _dirty = false; }
+    };
+
+    // debounce: delivers the last arguments once no post came for `quiet`.
+    // CLOCK is any std::chrono style clock (a static now()), poll() checks the deadline
+    template<typename SIGNATURE, typename CLOCK = std::chrono::steady_clock> class debounce;
+    template<typename... ARGS, typename CLOCK>
+    class debounce<void(ARGS...), CLOCK> {
+    public:
+        using duration = typename CLOCK::duration;
+        using time_point = typename CLOCK::time_point;
+
+    private:
+        callback<void(ARGS...)> _target;
+        coalesce_detail::pending_args<ARGS...> _pending;
+        duration _quiet;
+        time_point _deadline;
+        bool _dirty;
+
+    public:
+        debounce(callback<void(ARGS...)> target, duration quiet)
+            : _target(std::move(target)), _quiet(quiet), _deadline(), _dirty(false) {}
+
+        void post(ARGS... args) {
+            _pending.store(args...);
+            _deadline = CLOCK::now() + _quiet;
+            _dirty = true;
+        }
+        bool poll() { return poll(CLOCK::now()); }
+        bool poll(time_point now) {
+            if (!_dirty || now < _deadline) return false;
+            return flush();
+        }
+        // delivers what is pending without waiting for the deadline
+        bool flush() {
+            if (!_dirty) return false;
+            _dirty = false;
+            _pending.call(_target);
+            return true;
+        }
+        bool pending() const { return _dirty; }
+        void cancel() { _dirty = false; }
+    };
+
+    // throttle: at most one call per `interval`. a post inside the interval is held back
+    // (latest wins) and delivered by the first poll() after the interval ends
+    template<typename SIGNATURE, typename CLOCK = std::chrono::steady_clock> class throttle;
+    template<typename... ARGS, typename CLOCK>
+    class throttle<void(ARGS...), CLOCK> {
+    public:
+        using duration = typename CLOCK::duration;
+        using time_point = typename CLOCK::time_point;
+
+    private:
+        callback<void(ARGS...)> _target;
+        coalesce_detail::pending_args<ARGS...> _pending;
+        duration _interval;
+        time_point _next;               // first moment a new call is allowed
+        bool _dirty;
+
+    public:
+        throttle(callback<void(ARGS...)> target, duration interval)
+            : _target(std::move(target)), _interval(interval), _next(), _dirty(false) {}
+
+        // calls the target right away when the interval has passed, the arguments are not stored then
+        void post(ARGS... args) {
+            time_point now = CLOCK::now();
+            if (!_dirty && now >= _next) {
+                _next = now + _interval;
+                _target(args...);
+                return;
+            }
+            _pending.store(args...);
+            _dirty = true;
+        }
+        bool poll() { return poll(CLOCK::now()); }
+        bool poll(time_point now) {
+            if (!_dirty || now < _next) return false;
+            _next = now + _interval;
+            return flush();
+        }
+        // delivers what is pending regardless of the interval
+        bool flush() {
+            if (!_dirty) return false;
+            _dirty = false;
+            _pending.call(_target);
+            return true;
+        }
+        bool pending() const { return _dirty; }
+        void cancel() { _dirty = false; }
+    };
+
+    // latest value wins between one producer thread (post) and one consumer thread (flush).
+    // triple buffer: the producer fills its own slot and swaps it with the middle one, the consumer
+    // swaps its slot with the middle one when it is marked fresh. both sides are wait-free, nothing allocates
+    template<typename SIGNATURE> class latest_handoff;
+    template<typename... ARGS>
+    class latest_handoff<void(ARGS...)> {
+        static constexpr unsigned fresh = 4;
+        static constexpr std::size_t cache_line = 64;
+
+        // padded rather than alignas(64): over-aligned new needs C++17
+        struct slot {
+            coalesce_detail::pending_args<ARGS...> args;
+            char padding[cache_line];
+        };
+
+        callback<void(ARGS...)> _target;
+        slot _slots[3];
+        std::atomic<unsigned> _middle;  // slot index, | fresh when the producer swapped in new arguments
+        char _padding0[cache_line];
+        unsigned _back;                 // producer only
+        char _padding1[cache_line];
+        unsigned _front;                // consumer only
+
+    public:
+        explicit latest_handoff(callback<void(ARGS...)> target)
+            : _target(std::move(target)), _slots(), _middle(1), _back(0), _front(2) {}
+        latest_handoff(const latest_handoff&) = delete;
+        latest_handoff& operator=(const latest_handoff&) = delete;
+
+        // producer thread
+        void post(ARGS... args) {
+            _slots[_back].args.store(args...);
+            _back = _middle.exchange(_back | fresh, std::memory_order_acq_rel) & ~fresh;
+        }
+        // consumer thread: delivers the newest arguments posted since the last flush, if any
+        bool flush() {
+            if (!(_middle.load(std::memory_order_relaxed) & fresh)) return false;
+            _front = _middle.exchange(_front, std::memory_order_acq_rel) & ~fresh;
+            _slots[_front].args.call(_target);
+            return true;
+        }
+        bool pending() const { return (_middle.load(std::memory_order_relaxed) & fresh) != 0; }
+    };
+}
+#endif
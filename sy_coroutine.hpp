@@ -0,0 +1,209 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_COROUTINE_HPP
+#define SY_COROUTINE_HPP
+
+#if !defined(__cpp_impl_coroutine) || __cplusplus < 202002L
+#error "sy_coroutine.hpp needs C++20 coroutines"
+#endif
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include "sy_callback.hpp"
+
+namespace sy_callback {
+    // resumption target stored inline in a callback
+    struct coroutine_resumer {
+        std::coroutine_handle<> handle;
+        void resume() const { handle.resume(); }
+    };
+
+    // callback<void()> that resumes the coroutine, no allocation
+    inline callback<void()> resume_callback(std::coroutine_handle<> handle) {
+        return callback<void()>::make<coroutine_resumer, &coroutine_resumer::resume>(coroutine_resumer{ handle });
+    }
+
+    // one-shot completion slot: START receives a callback<void(T)> (callback<void()> for T = void)
+    // and hands it to the asynchronous operation, co_await yields the value it is called with.
+    // the slot may be called from any thread, even before START returns; it must be called exactly once
+    template<typename T, typename START>
+    class completion_awaiter {
+        using value_t = typename std::conditional<std::is_void<T>::value, char, T>::type;
+
+        enum : int { starting, suspended, completed };
+
+        START _start;
+        std::optional<value_t> _value;
+        std::atomic<int> _state;
+        std::coroutine_handle<> _handle;
+
+        // one word, stored inline in the callback: the coroutine is read from the awaiter, set before START runs
+        struct resumer {
+            completion_awaiter* awaiter;
+
+            void finish() const {
+                if (awaiter->_state.exchange(completed, std::memory_order_acq_rel) == suspended) awaiter->_handle.resume();
+            }
+            void resume(value_t value) const {
+                awaiter->_value.emplace(std::move(value));
+                finish();
+            }
+            void resume_void() const {
+                awaiter->_value.emplace();
+                finish();
+            }
+        };
+
+        static auto slot(resumer r) {
+            if constexpr (std::is_void<T>::value)
+                return callback<void()>::make<resumer, &resumer::resume_void>(r);
+            else
+                return callback<void(T)>::template make<resumer, &resumer::resume>(r);
+        }
+
+    public:
+        explicit completion_awaiter(START start) : _start(std::move(start)), _state(starting) {}
+        completion_awaiter(completion_awaiter&& other) : _start(std::move(other._start)), _state(starting) {}
+
+        bool await_ready() const noexcept { return false; }
+        bool await_suspend(std::coroutine_handle<> handle) {
+            _handle = handle;
+            _start(slot(resumer{ this }));
+            // the slot ran during START: do not suspend, the value is already there
+            return _state.exchange(suspended, std::memory_order_acq_rel) != completed;
+        }
+        T await_resume() {
+            if constexpr (!std::is_void<T>::value) return std::move(*_value);
+        }
+    };
+
+    template<typename T, typename START>
+    completion_awaiter<T, typename std::decay<START>::type> completion(START&& start) {
+        return completion_awaiter<T, typename std::decay<START>::type>(std::forward<START>(start));
+    }
+
+    // lazy coroutine: starts when awaited or when start() is called, resumes its awaiter when it finishes
+    template<typename T = void> class task;
+
+    namespace detail {
+        struct task_promise_base {
+            std::coroutine_handle<> continuation;
+            std::exception_ptr error;
+
+            struct final_awaiter {
+                bool await_ready() const noexcept { return false; }
+                template<typename PROMISE>
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<PROMISE> handle) noexcept {
+                    std::coroutine_handle<> next = handle.promise().continuation;
+                    return next ? next : std::noop_coroutine();
+                }
+                void await_resume() const noexcept {}
+            };
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            final_awaiter final_suspend() const noexcept { return {}; }
+            void unhandled_exception() { error = std::current_exception(); }
+        };
+
+        template<typename T>
+        struct task_promise : task_promise_base {
+            std::optional<T> value;
+
+            task<T> get_return_object();
+            template<typename U>
+            void return_value(U&& result) { value.emplace(std::forward<U>(result)); }
+            T take() {
+                if (error) std::rethrow_exception(error);
+                return std::move(*value);
+            }
+        };
+
+        template<>
+        struct task_promise<void> : task_promise_base {
+            task<void> get_return_object();
+            void return_void() const noexcept {}
+            void take() const {
+                if (error) std::rethrow_exception(error);
+            }
+        };
+    }
+
+    template<typename T>
+    class task {
+    public:
+        using promise_type = detail::task_promise<T>;
+
+    private:
+        std::coroutine_handle<promise_type> _handle;
+
+    public:
+        task() noexcept = default;
+        explicit task(std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+        task(task&& other) noexcept : _handle(std::exchange(other._handle, nullptr)) {}
+        task& operator=(task&& other) noexcept {
+            if (this != &other) {
+                if (_handle) _handle.destroy();
+                _handle = std::exchange(other._handle, nullptr);
+            }
+            return *this;
+        }
+        task(const task&) = delete;
+        task& operator=(const task&) = delete;
+        ~task() { if (_handle) _handle.destroy(); }
+
+        bool valid() const noexcept { return static_cast<bool>(_handle); }
+        bool done() const noexcept { return !_handle || _handle.done(); }
+
+        // runs the coroutine up to its first suspension, for a task nobody awaits
+        void start() { if (_handle && !_handle.done()) _handle.resume(); }
+        // value of a finished task, rethrows what the coroutine threw
+        T result() { return _handle.promise().take(); }
+
+        auto operator co_await() noexcept {
+            struct awaiter {
+                std::coroutine_handle<promise_type> handle;
+
+                bool await_ready() const noexcept { return !handle || handle.done(); }
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept {
+                    handle.promise().continuation = continuation;
+                    return handle;
+                }
+                T await_resume() { return handle.promise().take(); }
+            };
+            return awaiter{ _handle };
+        }
+    };
+
+    namespace detail {
+        template<typename T>
+        task<T> task_promise<T>::get_return_object() {
+            return task<T>(std::coroutine_handle<task_promise<T>>::from_promise(*this));
+        }
+        inline task<void> task_promise<void>::get_return_object() {
+            return task<void>(std::coroutine_handle<task_promise<void>>::from_promise(*this));
+        }
+    }
+}
+#endif
@@ -0,0 +1,208 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_EVENT_BUS_HPP
+#define SY_EVENT_BUS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "sy_callback.hpp"
+
+namespace sy_callback {
+    // typed publish / subscribe over a fixed list of event types. Each type owns a dense handler list,
+    // found by its position in EVENTS at compile time: publishing never hashes and never casts
+    template<typename... EVENTS>
+    class event_bus {
+        static_assert(sizeof...(EVENTS) > 0 && sizeof...(EVENTS) < 0x10000, "event_bus takes 1 to 65535 event types");
+
+        template<std::size_t... I>              struct      indices {};
+        template<std::size_t N, std::size_t... I>
+                                                struct      make_indices : make_indices<N - 1, N - 1, I...> {};
+        template<std::size_t... I>              struct      make_indices<0, I...> { using type = indices<I...>; };
+
+    public:
+        using connection_t = std::uint64_t;     // 0 is never a valid connection
+        template<typename EVENT>
+        using handler_t = callback<void(const EVENT&)>;
+
+    private:
+        template<typename EVENT>                struct      tag {};
+        // handlers sorted by descending priority, equal priorities in subscription order;
+        // _priorities[i] and _connections[i] belong to _handlers[i]
+        template<typename EVENT, std::size_t INDEX>
+        struct topic : tag<EVENT> {
+            std::vector<handler_t<EVENT>> _handlers;
+            std::vector<int> _priorities;
+            std::vector<connection_t> _connections;
+            std::vector<EVENT> _queue;          // posted, not dispatched yet
+            std::size_t _head = 0;              // next event of _queue to dispatch
+        };
+        // every topic is a base, an event type finds its own by overload resolution, without recursion
+        template<typename INDICES>              struct      topics;
+        template<std::size_t... I>              struct      topics<indices<I...>> : topic<EVENTS, I>... {};
+        template<typename EVENT, std::size_t INDEX>
+        static topic<EVENT, INDEX>& find(topic<EVENT, INDEX>& t) { return t; }
+        template<typename EVENT, std::size_t INDEX>
+        static const topic<EVENT, INDEX>& find(const topic<EVENT, INDEX>& t) { return t; }
+        template<typename EVENT, std::size_t INDEX>
+        static std::integral_constant<std::size_t, INDEX> index_of(const topic<EVENT, INDEX>*);
+
+        using topics_t = topics<typename make_indices<sizeof...(EVENTS)>::type>;
+
+        topics_t _topics;
+        std::vector<std::uint16_t> _order;      // event type of every posted event, in posting order
+        std::size_t _next = 0;                  // next entry of _order to dispatch
+        std::uint64_t _last = 0;
+
+        template<typename EVENT>                struct      topic_type {
+            static_assert(std::is_base_of<tag<EVENT>, topics_t>::value, "the event type is not in the event list of this bus");
+            using type = typename std::remove_reference<decltype(find<EVENT>(std::declval<topics_t&>()))>::type;
+        };
+        template<typename EVENT>
+        typename topic_type<EVENT>::type& topic_of() { return find<EVENT>(_topics); }
+        template<typename EVENT>
+        const typename topic_type<EVENT>::type& topic_of() const { return find<EVENT>(_topics); }
+
+    public:
+        // position of EVENT in EVENTS
+        template<typename EVENT>
+        using index = decltype(index_of<typename std::decay<EVENT>::type>(static_cast<topics_t*>(nullptr)));
+
+    private:
+        template<typename EVENT>
+        bool unsubscribe_from(connection_t connection) {
+            auto& t = topic_of<EVENT>();
+            for (std::size_t i = 0; i < t._connections.size(); ++i) {
+                if (t._connections[i] == connection) {
+                    std::ptrdiff_t at = static_cast<std::ptrdiff_t>(i);
+                    t._handlers.erase(t._handlers.begin() + at);
+                    t._priorities.erase(t._priorities.begin() + at);
+                    t._connections.erase(t._connections.begin() + at);
+                    return true;
+                }
+            }
+            return false;
+        }
+        // the event is moved out of the queue first: a handler may post and grow the queue,
+        // and an event whose handler throws is consumed all the same
+        template<typename EVENT>
+        void dispatch_next() {
+            auto& t = topic_of<EVENT>();
+            EVENT event(std::move(t._queue[t._head++]));
+            publish(event);
+        }
+        template<typename EVENT>
+        void drop_queue() {
+            auto& t = topic_of<EVENT>();
+            t._queue.clear();
+            t._head = 0;
+        }
+        template<typename EVENT>
+        void clear_topic() {
+            auto& t = topic_of<EVENT>();
+            t._handlers.clear();
+            t._priorities.clear();
+            t._connections.clear();
+        }
+
+        // runtime event index -> member function of that event type
+        using unsubscribe_t = bool (event_bus::*)(connection_t);
+        using action_t = void (event_bus::*)();
+
+    public:
+        static constexpr std::size_t event_count = sizeof...(EVENTS);
+
+        // higher priorities are called first; an empty handler is not subscribed and returns 0
+        template<typename EVENT>
+        connection_t subscribe(handler_t<EVENT> handler, int priority = 0) {
+            if (!handler) return 0;
+            auto& t = topic_of<EVENT>();
+            std::size_t at = t._priorities.size();
+            while (at > 0 && t._priorities[at - 1] < priority) --at;
+
+            connection_t connection = (++_last << 16) | index<EVENT>::value;
+            std::ptrdiff_t offset = static_cast<std::ptrdiff_t>(at);
+            t._handlers.insert(t._handlers.begin() + offset, std::move(handler));
+            t._priorities.insert(t._priorities.begin() + offset, priority);
+            t._connections.insert(t._connections.begin() + offset, connection);
+            return connection;
+        }
+        // the event type is read back from the connection, only that type's handlers are searched
+        bool unsubscribe(connection_t connection) {
+            static const unsubscribe_t table[] = { &event_bus::unsubscribe_from<EVENTS>... };
+            std::size_t type = static_cast<std::size_t>(connection & 0xFFFF);
+            return connection != 0 && type < event_count && (this->*table[type])(connection);
+        }
+        void clear() {
+            static const action_t table[] = { &event_bus::clear_topic<EVENTS>... };
+            for (action_t action : table) (this->*action)();
+        }
+
+        // calls the handlers of EVENT now, by priority. Handlers must not subscribe or unsubscribe
+        // the same event type while it is being published
+        template<typename EVENT>
+        void publish(const EVENT& event) const {
+            for (const handler_t<EVENT>& handler : topic_of<EVENT>()._handlers) handler(event);
+        }
+
+        // deferred publishing: the event is stored in the queue of its type until dispatch()
+        template<typename EVENT>
+        void post(EVENT&& event) {
+            using event_t = typename std::decay<EVENT>::type;
+            topic_of<event_t>()._queue.push_back(std::forward<EVENT>(event));
+            _order.push_back(static_cast<std::uint16_t>(index<event_t>::value));
+        }
+        // publishes every posted event in posting order, across event types, and returns how many.
+        // events posted by the handlers meanwhile are dispatched by the same call. When a handler throws,
+        // the exception propagates, that event counts as dispatched and the next dispatch() resumes after it
+        std::size_t dispatch() {
+            static const action_t next[] = { &event_bus::dispatch_next<EVENTS>... };
+            static const action_t drop[] = { &event_bus::drop_queue<EVENTS>... };
+            std::size_t count = 0;
+            for (; _next < _order.size(); ++count) (this->*next[_order[_next++]])();
+            for (std::size_t i = 0; i < _order.size(); ++i) (this->*drop[_order[i]])();
+            _order.clear();
+            _next = 0;
+            return count;
+        }
+        // drops the posted events without publishing them
+        void discard() {
+            static const action_t drop[] = { &event_bus::drop_queue<EVENTS>... };
+            for (std::size_t i = 0; i < _order.size(); ++i) (this->*drop[_order[i]])();
+            _order.clear();
+            _next = 0;
+        }
+        std::size_t pending() const { return _order.size() - _next; }
+
+        template<typename EVENT>
+        std::size_t size() const { return topic_of<EVENT>()._handlers.size(); }
+        template<typename EVENT>
+        bool empty() const { return topic_of<EVENT>()._handlers.empty(); }
+    };
+
+#if __cplusplus < 201703L
+    template<typename... EVENTS>
+    constexpr std::size_t event_bus<EVENTS...>::event_count;
+#endif
+}
+#endif
@@ -0,0 +1,241 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_MEMOIZE_HPP
+#define SY_MEMOIZE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "sy_callback.hpp"
+#include "sy_thread_ids.hpp"
+
+namespace sy_callback {
+    struct memo_statistics {
+        std::uint64_t hits;
+        std::uint64_t misses;
+        std::uint64_t evictions;
+
+        double hit_rate() const {
+            std::uint64_t calls = hits + misses;
+            return calls ? static_cast<double>(hits) / static_cast<double>(calls) : 0.0;
+        }
+    };
+
+    // caches the results of a pure callback in a table allocated once at construction.
+    // a key lives in a window of `window` slots starting at its hash, a miss in a full window
+    // evicts with CLOCK (second chance) inside that window, so no tombstones and no rehashing.
+    // every window keeps its own clock hand, in the entry it starts at
+    // arguments are stored decayed, they need std::hash and operator==; RETURN must be default constructible
+    template<typename SIGNATURE> class memoized;
+    template<typename RETURN, typename... ARGS>
+    class memoized<RETURN(ARGS...)> {
+        static_assert(!std::is_void<RETURN>::value, "memoized needs a result to cache");
+
+    public:
+        using key_type = std::tuple<typename std::decay<ARGS>::type...>;
+        static constexpr std::size_t window = 8;
+        static_assert(window <= 256, "the clock hand is one byte");
+
+    private:
+        struct entry {
+            key_type key;
+            RETURN value;
+            std::size_t hash;
+            bool used;
+            bool referenced;
+            unsigned char hand;     // clock hand of the window starting here, an offset in [0, window)
+
+            entry() : key(), value(), hash(0), used(false), referenced(false), hand(0) {}
+        };
+
+        callback<RETURN(ARGS...)> _target;
+        std::vector<entry> _entries;
+        std::size_t _mask;
+        memo_statistics _stats;
+
+        static std::size_t mix(std::size_t seed, std::size_t value) {
+            std::uint64_t h = (static_cast<std::uint64_t>(seed) ^ static_cast<std::uint64_t>(value)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<std::size_t>(h ^ (h >> 29));
+        }
+        static std::size_t hash_args(const typename std::decay<ARGS>::type&... args) {
+            std::size_t seed = 0;
+            using expand = int[];
+            (void)expand{ 0, (seed = mix(seed, std::hash<typename std::decay<ARGS>::type>()(args)), 0)... };
+            return seed;
+        }
+
+        // second chance inside the window: the hand resumes where the last eviction left it,
+        // referenced entries are spared once. ends within one turn plus one entry
+        entry& evict(std::size_t start) {
+            unsigned char& hand = _entries[start].hand;
+            for (;;) {
+                entry& e = _entries[(start + hand) & _mask];
+                hand = static_cast<unsigned char>((hand + 1) % window);
+                if (!e.referenced) return e;
+                e.referenced = false;
+            }
+        }
+
+    public:
+        // capacity is rounded up to a power of two of at least `window` entries
+        memoized(callback<RETURN(ARGS...)> target, std::size_t capacity) : _target(std::move(target)), _stats() {
+            std::size_t size = window;
+            while (size < capacity) size *= 2;
+            _entries.resize(size);
+            _mask = size - 1;
+        }
+
+        RETURN operator()(ARGS... args) {
+            std::size_t hash = hash_args(args...);
+            std::size_t start = hash & _mask;
+            entry* free_entry = nullptr;
+            for (std::size_t i = 0; i < window; ++i) {
+                entry& e = _entries[(start + i) & _mask];
+                if (!e.used) {
+                    if (!free_entry) free_entry = &e;
+                }
+                else if (e.hash == hash && e.key == std::tie(args...)) {
+                    e.referenced = true;
+                    ++_stats.hits;
+                    return e.value;
+                }
+            }
+
+            ++_stats.misses;
+            RETURN value = _target(args...);
+            entry* e = free_entry;
+            if (!e) {
+                e = &evict(start);
+                ++_stats.evictions;
+            }
+            e->key = key_type(args...);
+            e->value = value;
+            e->hash = hash;
+            e->used = true;
+            e->referenced = true;
+            return value;
+        }
+
+        std::size_t capacity() const { return _entries.size(); }
+        std::size_t size() const {
+            std::size_t count = 0;
+            for (const entry& e : _entries) count += e.used;
+            return count;
+        }
+        memo_statistics stats() const { return _stats; }
+        double hit_rate() const { return _stats.hit_rate(); }
+        void reset_stats() { _stats = memo_statistics(); }
+        // forgets every result, the table keeps its memory
+        void clear() {
+            for (entry& e : _entries) {
+                e.used = false;
+                e.referenced = false;
+            }
+        }
+    };
+
+    // one memoized table per thread for concurrent callers: the thread with id i owns shard i and calls it
+    // without locking. threads whose id is beyond the shard count share one extra table under a mutex.
+    // a shard passes to the next thread given the same id, the handover goes through the id lock.
+    // every table is allocated up front. stats() is published by the owners after each call and may lag
+    // a call in flight, clear() takes effect at each shard's next call
+    template<typename SIGNATURE> class sharded_memoized;
+    template<typename RETURN, typename... ARGS>
+    class sharded_memoized<RETURN(ARGS...)> {
+        struct shard {
+            memoized<RETURN(ARGS...)> cache;
+            std::size_t cleared;                    // last clear() generation applied, owner only
+            std::atomic<std::uint64_t> hits;        // published by the owner, read by stats()
+            std::atomic<std::uint64_t> misses;
+            std::atomic<std::uint64_t> evictions;
+            memo_statistics baseline;               // published values at the last reset_stats(), under _mutex
+            char padding[64];
+
+            shard(const callback<RETURN(ARGS...)>& target, std::size_t capacity)
+                : cache(target, capacity), cleared(0), hits(0), misses(0), evictions(0), baseline() {}
+
+            RETURN call(std::size_t generation, ARGS... args) {
+                if (cleared != generation) {
+                    cache.clear();
+                    cleared = generation;
+                }
+                RETURN value = cache(args...);
+                memo_statistics now = cache.stats();
+                hits.store(now.hits, std::memory_order_relaxed);
+                misses.store(now.misses, std::memory_order_relaxed);
+                evictions.store(now.evictions, std::memory_order_relaxed);
+                return value;
+            }
+        };
+
+        std::vector<std::unique_ptr<shard>> _shards;    // _shards.back() is the shared one
+        std::mutex _shared;
+        std::mutex _mutex;                              // stats() and reset_stats()
+        std::atomic<std::size_t> _cleared;
+
+    public:
+        // shards: owned tables, 0 uses std::thread::hardware_concurrency. capacity is per table
+        sharded_memoized(callback<RETURN(ARGS...)> target, std::size_t capacity, std::size_t shards = 0) : _cleared(0) {
+            if (shards == 0) shards = std::thread::hardware_concurrency();
+            if (shards == 0) shards = 1;
+            for (std::size_t i = 0; i <= shards; ++i) _shards.emplace_back(new shard(target, capacity));
+        }
+
+        RETURN operator()(ARGS... args) {
+            std::size_t id = thread_ids::current();
+            std::size_t generation = _cleared.load(std::memory_order_acquire);
+            if (id + 1 < _shards.size()) return _shards[id]->call(generation, args...);
+            std::lock_guard<std::mutex> lock(_shared);
+            return _shards.back()->call(generation, args...);
+        }
+
+        std::size_t shards() const { return _shards.size() - 1; }
+        // sum over the shards since the last reset_stats()
+        memo_statistics stats() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            memo_statistics total = memo_statistics();
+            for (const std::unique_ptr<shard>& s : _shards) {
+                total.hits += s->hits.load(std::memory_order_relaxed) - s->baseline.hits;
+                total.misses += s->misses.load(std::memory_order_relaxed) - s->baseline.misses;
+                total.evictions += s->evictions.load(std::memory_order_relaxed) - s->baseline.evictions;
+            }
+            return total;
+        }
+        double hit_rate() { return stats().hit_rate(); }
+        void reset_stats() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (const std::unique_ptr<shard>& s : _shards) {
+                s->baseline.hits = s->hits.load(std::memory_order_relaxed);
+                s->baseline.misses = s->misses.load(std::memory_order_relaxed);
+                s->baseline.evictions = s->evictions.load(std::memory_order_relaxed);
+            }
+        }
+        void clear() { _cleared.fetch_add(1, std::memory_order_release); }
+    };
+}
+#endif
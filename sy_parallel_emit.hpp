@@ -0,0 +1,228 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_PARALLEL_EMIT_HPP
+#define SY_PARALLEL_EMIT_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+#include "sy_signal.hpp"
+
+namespace sy_callback {
+    // worker set for parallel emission, the calling thread always takes part as worker 0
+    class emit_pool {
+        static constexpr std::size_t cache_line = 64;
+
+        template<typename T> struct no_deduce { using type = T; };
+
+        // per worker result, padded so neighbouring workers never share a line
+        template<typename T>
+        struct partial {
+            T value;
+            char padding[cache_line];
+        };
+
+        // one partial<T> per worker, constructed in the pool's scratch bytes and destroyed on scope exit
+        template<typename T>
+        class partial_array {
+            using partial_t = partial<T>;
+            partial_t* _data;
+            std::size_t _size;
+
+        public:
+            partial_array(std::vector<unsigned char>& scratch, std::size_t workers, const T& identity) : _data(nullptr), _size(0) {
+                std::size_t bytes = workers * sizeof(partial_t);
+                if (scratch.size() < bytes + alignof(partial_t)) scratch.resize(bytes + alignof(partial_t));
+                void* base = scratch.data();
+                std::size_t space = scratch.size();
+                _data = static_cast<partial_t*>(std::align(alignof(partial_t), bytes, base, space));
+                try { for (; _size < workers; ++_size) new (&_data[_size]) partial_t{ identity, {} }; }
+                catch (...) { while (_size) _data[--_size].~partial_t(); throw; }
+            }
+            ~partial_array() { while (_size) _data[--_size].~partial_t(); }
+            partial_array(const partial_array&) = delete;
+            partial_array& operator=(const partial_array&) = delete;
+
+            partial_t& operator[](std::size_t worker) { return _data[worker]; }
+            std::size_t size() const { return _size; }
+        };
+
+        std::vector<std::thread> _threads;
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        callback<void(std::size_t)> _job;
+        std::size_t _generation;
+        std::size_t _workers;                   // workers taking part in the current job, caller included
+        bool _stop;
+        std::atomic<std::size_t> _remaining;
+        std::exception_ptr _error;
+        std::size_t _threshold;
+        std::vector<unsigned char> _scratch;    // emit_reduce partials, kept between emissions and only ever grown
+
+        void work(std::size_t worker) {
+            std::size_t seen = 0;
+            for (;;) {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _wake.wait(lock, [&]() { return _stop || (_generation != seen && worker < _workers); });
+                    if (_stop) return;
+                    seen = _generation;
+                }
+                execute(worker);
+                _remaining.fetch_sub(1, std::memory_order_acq_rel);
+            }
+        }
+
+        void execute(std::size_t worker) {
+            try { _job(worker); }
+            catch (...) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (!_error) _error = std::current_exception();
+            }
+        }
+
+        // runs job(worker) for worker in [0, workers), returns once all of them are done
+        void run(std::size_t workers, callback<void(std::size_t)> job) {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _job = std::move(job);
+                _workers = workers;
+                _error = nullptr;
+                _remaining.store(workers - 1, std::memory_order_relaxed);
+                ++_generation;
+            }
+            if (workers > 1) _wake.notify_all();
+            execute(0);
+            while (_remaining.load(std::memory_order_acquire) != 0) std::this_thread::yield();
+
+            std::exception_ptr error;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _job.reset();
+                error = _error;
+                _error = nullptr;
+            }
+            if (error) std::rethrow_exception(error);
+        }
+
+        // the job lives on the emitting thread's stack until run returns, binding it by pointer avoids an allocation
+        template<typename JOB>
+        static callback<void(std::size_t)> bind(JOB& job) {
+            return callback<void(std::size_t)>::template make<JOB, &JOB::operator()>(&job);
+        }
+
+        // contiguous ranges whose boundaries fall on cache lines of the slot array
+        template<typename SLOT>
+        static std::size_t split(std::size_t size, std::size_t workers, std::size_t worker) {
+            const std::size_t per_line = sizeof(SLOT) < cache_line ? cache_line / sizeof(SLOT) : 1;
+            std::size_t lines = (size + per_line - 1) / per_line;
+            std::size_t begin = lines * worker / workers * per_line;
+            return begin < size ? begin : size;
+        }
+        template<typename SLOT>
+        std::size_t workers_for(std::size_t size) const {
+            const std::size_t per_line = sizeof(SLOT) < cache_line ? cache_line / sizeof(SLOT) : 1;
+            std::size_t lines = (size + per_line - 1) / per_line;
+            std::size_t workers = _threads.size() + 1;
+            return lines < workers ? lines : workers;
+        }
+
+    public:
+        // threads: total worker count including the caller, 0 uses std::thread::hardware_concurrency.
+        // threshold: signals with fewer slots are emitted serially on the caller
+        explicit emit_pool(std::size_t threads = 0, std::size_t threshold = 256)
+            : _generation(0), _workers(0), _stop(false), _remaining(0), _threshold(threshold) {
+            if (threads == 0) threads = std::thread::hardware_concurrency();
+            for (std::size_t i = 1; i < threads; ++i) _threads.emplace_back(&emit_pool::work, this, i);
+        }
+        ~emit_pool() {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _wake.notify_all();
+            for (std::thread& thread : _threads) thread.join();
+        }
+        emit_pool(const emit_pool&) = delete;
+        emit_pool& operator=(const emit_pool&) = delete;
+
+        std::size_t threads() const { return _threads.size() + 1; }
+        std::size_t threshold() const { return _threshold; }
+        void threshold(std::size_t threshold) { _threshold = threshold; }
+
+        // calls every slot once, slots run concurrently and in no particular order.
+        // one emission at a time per pool, the first exception thrown by a slot is rethrown here
+        template<typename RETURN, typename... ARGS>
+        void emit(const signal<RETURN(ARGS...)>& sig, typename no_deduce<ARGS>::type... args) {
+            using slot_t = typename signal<RETURN(ARGS...)>::slot_t;
+            const slot_t* slots = sig.data();
+            std::size_t size = sig.size();
+            std::size_t workers = workers_for<slot_t>(size);
+            if (size < _threshold || workers < 2) {
+                for (std::size_t i = 0; i < size; ++i) slots[i](args...);
+                return;
+            }
+            auto job = [&](std::size_t worker) {
+                std::size_t end = split<slot_t>(size, workers, worker + 1);
+                for (std::size_t i = split<slot_t>(size, workers, worker); i < end; ++i) slots[i](args...);
+            };
+            run(workers, bind(job));
+        }
+
+        // reduction: every worker folds its range starting from identity, the partial results are
+        // folded in worker order. slot results are converted to T, reduce(T, T) must be associative
+        // and identity its neutral element. the partials live in the pool, a reduction allocates nothing
+        // once the pool has seen as many workers and as large a T
+        template<typename RETURN, typename... ARGS, typename T, typename REDUCE>
+        T emit_reduce(const signal<RETURN(ARGS...)>& sig, T identity, REDUCE reduce, typename no_deduce<ARGS>::type... args) {
+            using slot_t = typename signal<RETURN(ARGS...)>::slot_t;
+            const slot_t* slots = sig.data();
+            std::size_t size = sig.size();
+            std::size_t workers = workers_for<slot_t>(size);
+            if (size < _threshold || workers < 2) {
+                T result = identity;
+                for (std::size_t i = 0; i < size; ++i) result = reduce(result, static_cast<T>(slots[i](args...)));
+                return result;
+            }
+
+            partial_array<T> partials(_scratch, workers, identity);
+            auto job = [&](std::size_t worker) {
+                T result = identity;
+                std::size_t end = split<slot_t>(size, workers, worker + 1);
+                for (std::size_t i = split<slot_t>(size, workers, worker); i < end; ++i)
+                    result = reduce(result, static_cast<T>(slots[i](args...)));
+                partials[worker].value = result;
+            };
+            run(workers, bind(job));
+
+            T result = identity;
+            for (std::size_t worker = 0; worker < partials.size(); ++worker) result = reduce(result, partials[worker].value);
+            return result;
+        }
+    };
+}
+#endif
@@ -0,0 +1,141 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_PLUGIN_HPP
+#define SY_PLUGIN_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <dlfcn.h>
+#include "sy_callback.hpp"
+
+namespace sy_callback {
+    class plugin_error : public std::runtime_error {
+    public:
+        explicit plugin_error(const std::string& message) : std::runtime_error(message) {}
+    };
+
+    // entry points of shared libraries, declared up front and loaded on first use:
+    // declare() opens nothing, the first call of a declared callback dlopens its library (once per path),
+    // dlsyms the symbol (once per entry) and publishes the address with a release store; later calls load it with acquire.
+    // libraries stay loaded until the registry is destroyed, callbacks must not be called after that
+    class plugin_registry {
+        struct library {
+            std::string path;
+            void* handle;
+        };
+        struct entry {
+            plugin_registry* registry;
+            library* owner;
+            std::string symbol;
+            std::atomic<void*> address;
+        };
+
+        std::mutex _mutex;
+        std::deque<library> _libraries;     // deques keep the addresses the callbacks point to stable
+        std::deque<entry> _entries;
+
+        library* find_library(const std::string& path) {
+            for (library& lib : _libraries) if (lib.path == path) return &lib;
+            _libraries.push_back(library{ path, nullptr });
+            return &_libraries.back();
+        }
+
+        void* load(entry& e) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            void* address = e.address.load(std::memory_order_relaxed);
+            if (address) return address;
+
+            if (!e.owner->handle) {
+                e.owner->handle = ::dlopen(e.owner->path.c_str(), RTLD_LAZY | RTLD_LOCAL);
+                if (!e.owner->handle) {
+                    const char* error = ::dlerror();
+                    throw plugin_error(error ? error : "dlopen failed: " + e.owner->path);
+                }
+            }
+            ::dlerror();
+            address = ::dlsym(e.owner->handle, e.symbol.c_str());
+            if (!address) {
+                const char* error = ::dlerror();
+                throw plugin_error(error ? error : "symbol not found: " + e.symbol);
+            }
+            e.address.store(address, std::memory_order_release);
+            return address;
+        }
+
+        struct resolver {
+            static void* resolve(const void* state) {
+                entry& e = *static_cast<entry*>(const_cast<void*>(state));
+                void* address = e.address.load(std::memory_order_acquire);
+                return address ? address : e.registry->load(e);
+            }
+        };
+
+    public:
+        plugin_registry() = default;
+        ~plugin_registry() {
+            for (library& lib : _libraries) if (lib.handle) ::dlclose(lib.handle);
+        }
+        plugin_registry(const plugin_registry&) = delete;
+        plugin_registry& operator=(const plugin_registry&) = delete;
+
+        // SIGNATURE is the signature of the exported function, e.g. int(const char*)
+        template<typename SIGNATURE>
+        callback<SIGNATURE> declare(const std::string& path, const std::string& symbol) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            library* owner = find_library(path);
+            _entries.emplace_back();
+            entry& e = _entries.back();
+            e.registry = this;
+            e.owner = owner;
+            e.symbol = symbol;
+            e.address.store(nullptr, std::memory_order_relaxed);
+            return callback<SIGNATURE>::template make_lazy<resolver>(&e);
+        }
+
+        // loads every declared entry point now, e.g. off the startup path; throws plugin_error
+        void resolve_all() {
+            for (std::size_t i = 0; i < declared(); ++i) {
+                entry* e;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    e = &_entries[i];
+                }
+                resolver::resolve(e);
+            }
+        }
+
+        std::size_t declared() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _entries.size();
+        }
+        std::size_t loaded_libraries() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            std::size_t count = 0;
+            for (const library& lib : _libraries) count += lib.handle != nullptr;
+            return count;
+        }
+    };
+}
+#endif
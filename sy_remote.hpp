@@ -0,0 +1,203 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_REMOTE_HPP
+#define SY_REMOTE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <vector>
+#include "sy_callback.hpp"
+
+namespace sy_callback {
+    // calls that cross a process boundary, e.g. through a ring buffer in shared memory: a callback holds
+    // absolute addresses, so the sender only writes a small integer ID and the argument bytes, and the
+    // receiver looks the ID up in its own dense table of callbacks
+
+    // typed ID of a registered handler, the sender only needs this value and the signature
+    template<typename SIGNATURE> struct remote_id;
+    template<typename... ARGS>
+    struct remote_id<void(ARGS...)> {
+        std::uint32_t value;
+    };
+
+    // one serialized call: trivially copyable and position independent, 64 bytes by default.
+    // the arguments are packed byte by byte, in order, without padding
+    template<std::size_t CAPACITY = 56>
+    struct invocation {
+        std::uint32_t id;
+        std::uint32_t size;                     // bytes of args in use, checked against the handler
+        unsigned char args[CAPACITY];
+    };
+
+    namespace remote_detail {
+        template<std::size_t... I>              struct      indices {};
+        template<std::size_t N, std::size_t... I>
+                                                struct      make_indices : make_indices<N - 1, N - 1, I...> {};
+        template<std::size_t... I>              struct      make_indices<0, I...> { using type = indices<I...>; };
+
+        // bytes before the I-th argument
+        template<std::size_t I, typename... T>  struct      offset_of;
+        template<typename T, typename... REST>  struct      offset_of<0, T, REST...> : std::integral_constant<std::size_t, 0> {};
+        template<std::size_t I, typename T, typename... REST>
+                                                struct      offset_of<I, T, REST...>
+            : std::integral_constant<std::size_t, sizeof(T) + offset_of<I - 1, REST...>::value> {};
+
+        template<typename... T>                 struct      payload_size : std::integral_constant<std::size_t, 0> {};
+        template<typename T, typename... REST>  struct      payload_size<T, REST...>
+            : std::integral_constant<std::size_t, sizeof(T) + payload_size<REST...>::value> {};
+
+        template<typename... T>                 struct      all_transferable : std::true_type {};
+        template<typename T, typename... REST>  struct      all_transferable<T, REST...> {
+            static constexpr bool value =
+                std::is_trivially_copyable<T>::value && !std::is_pointer<T>::value &&
+                !std::is_member_pointer<T>::value && all_transferable<REST...>::value;
+        };
+
+        template<std::size_t CAPACITY, typename... ARGS>
+        struct codec {
+            static constexpr std::size_t size = payload_size<typename std::decay<ARGS>::type...>::value;
+            static_assert(size <= CAPACITY, "the arguments do not fit the invocation record");
+            static_assert(all_transferable<typename std::decay<ARGS>::type...>::value,
+                "remote arguments must be trivially copyable and must not be pointers");
+
+            template<typename T>
+            static T read(const unsigned char* bytes) {
+                T value;
+                std::memcpy(&value, bytes, sizeof(T));
+                return value;
+            }
+            template<std::size_t... I>
+            static void call(const callback<void(ARGS...)>& handler, const unsigned char* bytes, indices<I...>) {
+                (void)bytes;                    // unread without arguments
+                handler(read<typename std::decay<ARGS>::type>(
+                    bytes + offset_of<I, typename std::decay<ARGS>::type...>::value)...);
+            }
+            static void invoke(const void* handler, const unsigned char* bytes) {
+                call(*static_cast<const callback<void(ARGS...)>*>(handler), bytes,
+                    typename make_indices<sizeof...(ARGS)>::type());
+            }
+            static void destroy(void* handler) {
+                static_cast<callback<void(ARGS...)>*>(handler)->~callback();
+            }
+
+            static void write(unsigned char*) {}
+            template<typename T, typename... REST>
+            static void write(unsigned char* bytes, const T& value, const REST&... rest) {
+                std::memcpy(bytes, &value, sizeof(T));
+                write(bytes + sizeof(T), rest...);
+            }
+        };
+
+        template<typename T>                    struct      identity { using type = T; };
+    }
+
+    // serializes a call of id into record, the arguments are converted to the handler's parameter types
+    template<std::size_t CAPACITY, typename... ARGS>
+    void encode(invocation<CAPACITY>& record, remote_id<void(ARGS...)> id,
+                typename remote_detail::identity<ARGS>::type... args) {
+        using codec_t = remote_detail::codec<CAPACITY, ARGS...>;
+        record.id = id.value;
+        record.size = static_cast<std::uint32_t>(codec_t::size);
+        codec_t::write(record.args, static_cast<const typename std::decay<ARGS>::type&>(args)...);
+    }
+    template<std::size_t CAPACITY = 56, typename... ARGS>
+    invocation<CAPACITY> encode(remote_id<void(ARGS...)> id, typename remote_detail::identity<ARGS>::type... args) {
+        invocation<CAPACITY> record = {};      // no stale bytes after the arguments
+        encode<CAPACITY, ARGS...>(record, id, args...);
+        return record;
+    }
+
+    // receiver side: handlers of any void(ARGS...) signature in one table indexed by ID.
+    // both processes agree on the IDs, either by registering in the same order or with explicit IDs
+    template<std::size_t CAPACITY = 56>
+    class remote_registry {
+        // the handler lives in raw storage: every callback<void(ARGS...)> has the same size and, like its own
+        // move constructor assumes, can be relocated bitwise, so the table grows like a plain array
+        struct entry {
+            void (*invoke)(const void* handler, const unsigned char* bytes);    // nullptr: free ID
+            void (*destroy)(void* handler);
+            std::uint32_t size;
+            alignas(callback<void()>) unsigned char handler[sizeof(callback<void()>)];
+        };
+
+        std::vector<entry> _table;
+
+        void release(entry& e) {
+            if (e.invoke) e.destroy(e.handler);
+            e.invoke = nullptr;
+            e.destroy = nullptr;
+        }
+
+    public:
+        using record_t = invocation<CAPACITY>;
+
+        remote_registry() = default;
+        ~remote_registry() { for (entry& e : _table) release(e); }
+        remote_registry(const remote_registry&) = delete;
+        remote_registry& operator=(const remote_registry&) = delete;
+
+        // registers under the next free ID at the end of the table
+        template<typename SIGNATURE>
+        remote_id<SIGNATURE> add(callback<SIGNATURE> handler) {
+            return add<SIGNATURE>(static_cast<std::uint32_t>(_table.size()), std::move(handler));
+        }
+        // registers under id, replacing what was there
+        template<typename SIGNATURE>
+        remote_id<SIGNATURE> add(std::uint32_t id, callback<SIGNATURE> handler) {
+            return add_as(id, std::move(handler));
+        }
+        template<typename... ARGS>
+        remote_id<void(ARGS...)> add_as(std::uint32_t id, callback<void(ARGS...)> handler) {
+            using codec_t = remote_detail::codec<CAPACITY, ARGS...>;
+            static_assert(sizeof(callback<void(ARGS...)>) == sizeof(callback<void()>), "callback layout differs by signature");
+            if (id >= _table.size()) _table.resize(id + 1, entry{ nullptr, nullptr, 0, {} });
+            entry& e = _table[id];
+            release(e);
+            new (e.handler) callback<void(ARGS...)>(std::move(handler));
+            e.invoke = &codec_t::invoke;
+            e.destroy = &codec_t::destroy;
+            e.size = static_cast<std::uint32_t>(codec_t::size);
+            return remote_id<void(ARGS...)>{ id };
+        }
+        bool remove(std::uint32_t id) {
+            if (id >= _table.size() || !_table[id].invoke) return false;
+            release(_table[id]);
+            return true;
+        }
+
+        // one bounds check, one size check and the call; false for an unknown ID or a record whose
+        // argument size does not match the handler (a sender built against another signature)
+        bool dispatch(const record_t& record) const {
+            if (record.id >= _table.size()) return false;
+            const entry& e = _table[record.id];
+            if (!e.invoke || e.size != record.size) return false;
+            e.invoke(e.handler, record.args);
+            return true;
+        }
+
+        bool contains(std::uint32_t id) const { return id < _table.size() && _table[id].invoke; }
+        std::size_t capacity() const { return _table.size(); }
+    };
+}
+#endif
@@ -0,0 +1,225 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_SHARDED_HPP
+#define SY_SHARDED_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "sy_callback.hpp"
+#include "sy_thread_ids.hpp"
+
+namespace sy_callback {
+    // handlers replicated per core: each worker reads its own shard, a slab of callbacks that shares no
+    // cache line with another shard. The slab is allocated by the thread that reads the shard first, so with
+    // first-touch placement it sits on that thread's NUMA node. Registering is a broadcast: the master table
+    // is updated and a version bumped, and each shard copies the changed slots the next time its owner reads it
+    template<typename RETURN, typename... ARGS>
+    class sharded_registry<RETURN(ARGS...)> {
+        static constexpr std::size_t cache_line = 64;
+
+    public:
+        using handler_t = callback<RETURN(ARGS...)>;
+        using slot_t = std::size_t;             // the same index on every shard
+        static constexpr slot_t invalid_slot = static_cast<slot_t>(-1);
+
+    private:
+        // padded rather than alignas(64): over-aligned new needs C++17
+        struct shard {
+            handler_t* handlers;                // starts on a cache line, rounded up to whole lines
+            void* memory;
+            std::size_t size;
+            std::size_t capacity;
+            std::uint64_t version;              // of the master table when this shard last copied it
+            char padding[cache_line];
+
+            shard() : handlers(nullptr), memory(nullptr), size(0), capacity(0), version(0) {}
+        };
+
+        std::mutex _mutex;
+        std::vector<handler_t> _handlers;       // master table, written under _mutex
+        std::vector<std::uint64_t> _stamps;     // version that last wrote each slot
+        std::vector<bool> _used;
+        std::vector<slot_t> _free;
+        char _padding0[cache_line];
+        std::vector<std::unique_ptr<shard>> _shards;    // not written after construction
+        std::atomic<std::uint64_t> _version;    // the only line the read path shares, written by registrations
+        char _padding1[cache_line];
+
+        static bool is_empty(const handler_t& handler) { return handler._thunk == handler_t::thunk_nothing(); }
+
+        // every shard holds a copy: a handler whose target cannot be copied would be empty on all of them
+        static bool copyable(const handler_t& handler, handler_t& copy) {
+            copy = handler;
+            return is_empty(copy) == is_empty(handler);
+        }
+        template<typename ANY_T>                struct      is_target : std::integral_constant<bool,
+            !std::is_same<typename std::decay<ANY_T>::type, handler_t>::value> {};
+
+        void publish(slot_t slot, handler_t handler) {
+            std::uint64_t version = _version.load(std::memory_order_relaxed) + 1;
+            _handlers[slot] = std::move(handler);
+            _stamps[slot] = version;
+            _version.store(version, std::memory_order_release);
+        }
+
+        shard& sync(std::size_t index) {
+            shard& s = *_shards[index];
+            if (s.version != _version.load(std::memory_order_acquire)) copy_pending(s);
+            return s;
+        }
+        // runs on the owner: the slab and the copied functors are allocated by that thread
+        void copy_pending(shard& s) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_handlers.size() > s.capacity) grow(s, _handlers.size());
+            for (std::size_t i = 0; i < _handlers.size(); ++i) {
+                if (i >= s.size) new (&s.handlers[i]) handler_t(_handlers[i]);
+                else if (_stamps[i] > s.version) s.handlers[i] = _handlers[i];
+            }
+            s.size = _handlers.size();
+            s.version = _version.load(std::memory_order_relaxed);
+        }
+        static void grow(shard& s, std::size_t needed) {
+            std::size_t capacity = s.capacity * 2 < needed ? needed : s.capacity * 2;
+            std::size_t bytes = (capacity * sizeof(handler_t) + cache_line - 1) / cache_line * cache_line;
+            void* memory = ::operator new(bytes + cache_line);
+            std::uintptr_t address = (reinterpret_cast<std::uintptr_t>(memory) + cache_line - 1) &
+                                     ~static_cast<std::uintptr_t>(cache_line - 1);
+            handler_t* handlers = reinterpret_cast<handler_t*>(address);
+            for (std::size_t i = 0; i < s.size; ++i) {
+                new (&handlers[i]) handler_t(std::move(s.handlers[i]));
+                s.handlers[i].~handler_t();
+            }
+            ::operator delete(s.memory);
+            s.handlers = handlers;
+            s.memory = memory;
+            s.capacity = bytes / sizeof(handler_t);
+        }
+        static void release(shard& s) {
+            for (std::size_t i = 0; i < s.size; ++i) s.handlers[i].~handler_t();
+            ::operator delete(s.memory);
+        }
+
+    public:
+        // shards: 0 uses std::thread::hardware_concurrency
+        explicit sharded_registry(std::size_t shards = 0) : _version(0) {
+            if (shards == 0) shards = std::thread::hardware_concurrency();
+            if (shards == 0) shards = 1;
+            for (std::size_t i = 0; i < shards; ++i) _shards.emplace_back(new shard());
+        }
+        ~sharded_registry() { for (const std::unique_ptr<shard>& s : _shards) release(*s); }
+        sharded_registry(const sharded_registry&) = delete;
+        sharded_registry& operator=(const sharded_registry&) = delete;
+
+        // broadcast updates, from any thread. Each shard gets its own copy of the handler, so the target must
+        // be copyable: a functor passed directly is checked at compile time, a callback holding a move-only
+        // target is rejected (add returns invalid_slot, assign false)
+        slot_t add(const handler_t& handler) {
+            handler_t copy;
+            if (!copyable(handler, copy)) return invalid_slot;
+            std::lock_guard<std::mutex> lock(_mutex);
+            slot_t slot;
+            if (!_free.empty()) {
+                slot = _free.back();
+                _free.pop_back();
+            }
+            else {
+                slot = _handlers.size();
+                _handlers.emplace_back();
+                _stamps.push_back(0);
+                _used.push_back(false);
+            }
+            _used[slot] = true;
+            publish(slot, std::move(copy));
+            return slot;
+        }
+        template<typename ANY_T>
+        typename std::enable_if<is_target<ANY_T>::value, slot_t>::type add(ANY_T&& func) {
+            static_assert(std::is_copy_constructible<typename std::decay<ANY_T>::type>::value,
+                "every shard holds a copy of the handler: the target must be copyable");
+            return add(handler_t(std::forward<ANY_T>(func)));
+        }
+        bool assign(slot_t slot, const handler_t& handler) {
+            handler_t copy;
+            if (!copyable(handler, copy)) return false;
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (slot >= _used.size() || !_used[slot]) return false;
+            publish(slot, std::move(copy));
+            return true;
+        }
+        template<typename ANY_T>
+        typename std::enable_if<is_target<ANY_T>::value, bool>::type assign(slot_t slot, ANY_T&& func) {
+            static_assert(std::is_copy_constructible<typename std::decay<ANY_T>::type>::value,
+                "every shard holds a copy of the handler: the target must be copyable");
+            return assign(slot, handler_t(std::forward<ANY_T>(func)));
+        }
+        // the slot is reused by a later add()
+        bool remove(slot_t slot) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (slot >= _used.size() || !_used[slot]) return false;
+            _used[slot] = false;
+            _free.push_back(slot);
+            publish(slot, handler_t());
+            return true;
+        }
+
+        // the owner side: a shard is used by one thread at a time, normally the worker of one core.
+        // pending broadcasts are copied first, otherwise nothing but this shard's lines and the version is read.
+        // index must be below shards(), it is not checked
+        void emit(std::size_t index, ARGS... args) {
+            shard& s = sync(index);
+            for (std::size_t i = 0; i < s.size; ++i)
+                if (!is_empty(s.handlers[i])) s.handlers[i](args...);
+        }
+        RETURN invoke(std::size_t index, slot_t slot, ARGS... args) {
+            return sync(index).handlers[slot](args...);
+        }
+        // this shard's copy of slot: the owner may rebind it for itself until the next broadcast to that slot.
+        // the reference is invalidated by the next call on this shard that copies an add() the slab has no room
+        // for, the slab then moves. Do not hold it across emit, invoke, local or update
+        handler_t& local(std::size_t index, slot_t slot) { return sync(index).handlers[slot]; }
+        // copies pending broadcasts now, e.g. before a latency sensitive loop
+        void update(std::size_t index) { sync(index); }
+
+        std::size_t shards() const { return _shards.size(); }
+        // the calling thread's dense id (see thread_ids), so threads that exited hand their shard to new ones.
+        // two live threads get the same shard only when more threads are alive than there are shards,
+        // which is not supported: keep the live threads that call it at or below shards()
+        std::size_t this_shard() const { return thread_ids::current() % _shards.size(); }
+        std::size_t slots() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _handlers.size() - _free.size();
+        }
+    };
+
+#if __cplusplus < 201703L
+    template<typename RETURN, typename... ARGS>
+    constexpr typename sharded_registry<RETURN(ARGS...)>::slot_t sharded_registry<RETURN(ARGS...)>::invalid_slot;
+#endif
+}
+#endif
@@ -0,0 +1,150 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_SIGNAL_HPP
+#define SY_SIGNAL_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include "sy_callback.hpp"
+
+namespace sy_callback {
+    // a combiner is fed one slot result at a time and returns false once the result is decided:
+    //     bool operator()(VALUE value);   result_type result() const;
+    // the built-in ones keep a single value, combining never allocates
+    namespace combiners {
+        struct first_true {
+            using result_type = bool;
+            bool _value = false;
+
+            bool operator()(bool value) { _value = value; return !value; }
+            result_type result() const { return _value; }
+        };
+
+        struct all_of {
+            using result_type = bool;
+            bool _value = true;
+
+            bool operator()(bool value) { _value = value; return value; }
+            result_type result() const { return _value; }
+        };
+
+        template<typename T>
+        struct sum {
+            using result_type = T;
+            T _value;
+
+            sum(T initial = T()) : _value(initial) {}
+            bool operator()(const T& value) { _value = _value + value; return true; }
+            result_type result() const { return _value; }
+        };
+
+        // result() is T() when no slot ran, empty() tells the two apart
+        template<typename T>
+        struct max {
+            using result_type = T;
+            T _value = T();
+            bool _empty = true;
+
+            bool operator()(const T& value) {
+                if (_empty || _value < value) _value = value;
+                _empty = false;
+                return true;
+            }
+            result_type result() const { return _value; }
+            bool empty() const { return _empty; }
+        };
+
+        template<typename T>
+        struct last {
+            using result_type = T;
+            T _value = T();
+            bool _empty = true;
+
+            bool operator()(const T& value) { _value = value; _empty = false; return true; }
+            result_type result() const { return _value; }
+            bool empty() const { return _empty; }
+        };
+    }
+
+    // multicast container: slots are stored densely and called in connection order.
+    // not re-entrant: a slot must not connect, disconnect or clear the signal it is called from,
+    // the slot array may be erased from or reallocated under the running slot
+    template<typename SIGNATURE> class signal;
+    template<typename RETURN, typename... ARGS>
+    class signal<RETURN(ARGS...)> {
+    public:
+        using slot_t = callback<RETURN(ARGS...)>;
+        using connection_t = std::size_t;       // 0 is never a valid connection
+
+    private:
+        std::vector<slot_t> _slots;
+        std::vector<connection_t> _connections; // _connections[i] belongs to _slots[i]
+        connection_t _last;
+
+    public:
+        signal() : _last(0) {}
+
+        // an empty slot is not connected and returns 0
+        connection_t connect(slot_t slot) {
+            if (!slot) return 0;
+            _slots.push_back(std::move(slot));
+            _connections.push_back(++_last);
+            return _last;
+        }
+        bool disconnect(connection_t connection) {
+            for (std::size_t i = 0; i < _connections.size(); ++i) {
+                if (_connections[i] == connection) {
+                    _slots.erase(_slots.begin() + static_cast<std::ptrdiff_t>(i));
+                    _connections.erase(_connections.begin() + static_cast<std::ptrdiff_t>(i));
+                    return true;
+                }
+            }
+            return false;
+        }
+        void clear() {
+            _slots.clear();
+            _connections.clear();
+        }
+
+        std::size_t size() const { return _slots.size(); }
+        bool empty() const { return _slots.empty(); }
+        const slot_t* data() const { return _slots.data(); }
+        const slot_t* begin() const { return _slots.data(); }
+        const slot_t* end() const { return _slots.data() + _slots.size(); }
+
+        // calls every slot in connection order, results are discarded. Slots must not connect or disconnect during the call
+        void emit(ARGS... args) const {
+            for (const slot_t& slot : _slots) slot(args...);
+        }
+        void operator()(ARGS... args) const { emit(args...); }
+
+        // calls the slots in connection order and feeds each result to the combiner,
+        // the slots after the one that decided the result are not called.
+        // an lvalue combiner is used in place and can be inspected afterwards. Same rule as emit for connecting
+        template<typename COMBINER>
+        typename std::decay<COMBINER>::type::result_type combine(COMBINER&& combiner, ARGS... args) const {
+            for (const slot_t& slot : _slots) if (!combiner(slot(args...))) break;
+            return combiner.result();
+        }
+    };
+}
+#endif
@@ -0,0 +1,140 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_STATE_MACHINE_HPP
+#define SY_STATE_MACHINE_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "sy_callback.hpp"
+
+namespace sy_callback {
+    // table driven finite state machine: table[state][event] holds the next state and the action, so an
+    // event costs one index and one call. STATE and EVENT are enums or integers numbered from 0, the counts
+    // default to their count enumerator
+    template<typename STATE, typename EVENT, typename CONTEXT,
+             std::size_t STATES = static_cast<std::size_t>(STATE::count),
+             std::size_t EVENTS = static_cast<std::size_t>(EVENT::count)>
+    class state_machine {
+        static_assert(STATES > 0 && EVENTS > 0, "state_machine needs at least one state and one event");
+
+    public:
+        using action_t = callback<void(CONTEXT&)>;
+        // a table of these can be a constant-initialized static: function pointers and make<>() are constexpr
+        struct transition {
+            STATE next;
+            action_t action;                    // empty: no action
+        };
+        using table_t = transition[STATES][EVENTS];
+
+        static constexpr std::size_t state_count = STATES;
+        static constexpr std::size_t event_count = EVENTS;
+
+    private:
+        // an empty action is never called: a flag is cheaper than calling a no-op through the thunk
+        struct slot {
+            action_t action;
+            bool active;
+        };
+        struct entry {
+            action_t action;
+            STATE next;
+            bool active;
+        };
+
+        std::vector<entry> _table;              // STATES rows of EVENTS entries
+        std::vector<slot> _entry;
+        std::vector<slot> _exit;
+        STATE _state;
+
+        template<typename T>
+        static std::size_t index(T value) { return static_cast<std::size_t>(value); }
+
+        entry& entry_of(STATE state, EVENT event) { return _table[index(state) * EVENTS + index(event)]; }
+
+        static void bind(slot& s, action_t action) {
+            s.active = static_cast<bool>(action);
+            s.action = std::move(action);
+        }
+        // exit of the current state, the transition's action, entry of the next state
+        void change(CONTEXT& context, const entry& t) {
+            const slot& out = _exit[index(_state)];
+            if (out.active) out.action(context);
+            if (t.active) t.action(context);
+            _state = t.next;
+            const slot& in = _entry[index(_state)];
+            if (in.active) in.action(context);
+        }
+        void step(CONTEXT& context, const entry& t) {
+            if (t.next != _state) change(context, t);
+            else if (t.active) t.action(context);
+        }
+
+    public:
+        // every event leaves every state unchanged until bound with on()
+        explicit state_machine(STATE initial) : _table(STATES * EVENTS), _entry(STATES), _exit(STATES), _state(initial) {
+            for (std::size_t s = 0; s < STATES; ++s)
+                for (std::size_t e = 0; e < EVENTS; ++e) _table[s * EVENTS + e].next = static_cast<STATE>(s);
+        }
+        // copies table, which stays untouched: the machine can still be rebound
+        state_machine(const table_t& table, STATE initial) : state_machine(initial) {
+            for (std::size_t s = 0; s < STATES; ++s)
+                for (std::size_t e = 0; e < EVENTS; ++e)
+                    on(static_cast<STATE>(s), static_cast<EVENT>(e), table[s][e].next, table[s][e].action);
+        }
+
+        // rebinding, also at runtime between events. to == from is an internal transition: no exit, no entry
+        void on(STATE from, EVENT event, STATE to, action_t action = action_t()) {
+            entry& t = entry_of(from, event);
+            t.next = to;
+            t.active = static_cast<bool>(action);
+            t.action = std::move(action);
+        }
+        void on_entry(STATE state, action_t action) { bind(_entry[index(state)], std::move(action)); }
+        void on_exit(STATE state, action_t action) { bind(_exit[index(state)], std::move(action)); }
+        STATE next(STATE state, EVENT event) const { return _table[index(state) * EVENTS + index(event)].next; }
+
+        // event must be below EVENTS. Actions must not call process() on the same machine
+        STATE process(CONTEXT& context, EVENT event) {
+            step(context, entry_of(_state, event));
+            return _state;
+        }
+        // every event of [first, last) in order, returns the final state
+        template<typename ITERATOR>
+        STATE process(CONTEXT& context, ITERATOR first, ITERATOR last) {
+            const entry* table = _table.data();
+            for (; first != last; ++first) step(context, table[index(_state) * EVENTS + index(*first)]);
+            return _state;
+        }
+
+        STATE state() const { return _state; }
+        // sets the state without running exit or entry actions
+        void reset(STATE state) { _state = state; }
+    };
+
+#if __cplusplus < 201703L
+    template<typename STATE, typename EVENT, typename CONTEXT, std::size_t STATES, std::size_t EVENTS>
+    constexpr std::size_t state_machine<STATE, EVENT, CONTEXT, STATES, EVENTS>::state_count;
+    template<typename STATE, typename EVENT, typename CONTEXT, std::size_t STATES, std::size_t EVENTS>
+    constexpr std::size_t state_machine<STATE, EVENT, CONTEXT, STATES, EVENTS>::event_count;
+#endif
+}
+#endif
@@ -0,0 +1,137 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_SUBSCRIBER_SET_HPP
+#define SY_SUBSCRIBER_SET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "sy_callback.hpp"
+
+namespace sy_callback {
+    // multicast container keyed by the callback itself: a subscriber is disconnected with the callback it
+    // connected, found through a flat open-addressing index in O(1), and connecting it twice is refused.
+    // Slots are stored densely, a disconnect moves the last slot into the hole, so the call order is not
+    // the connection order
+    template<typename SIGNATURE> class subscriber_set;
+    template<typename RETURN, typename... ARGS>
+    class subscriber_set<RETURN(ARGS...)> {
+    public:
+        using slot_t = callback<RETURN(ARGS...)>;
+
+    private:
+        std::vector<slot_t> _slots;
+        std::vector<std::size_t> _hashes;       // _hashes[i] belongs to _slots[i]
+        std::vector<std::uint32_t> _index;      // position + 1 in _slots, 0 is a free bucket. Power of two
+        std::size_t _mask;
+
+        // the bucket holding slot, or the free bucket where it would go
+        std::size_t find(const slot_t& slot, std::size_t hash) const {
+            std::size_t bucket = hash & _mask;
+            while (std::uint32_t entry = _index[bucket]) {
+                if (_hashes[entry - 1] == hash && _slots[entry - 1] == slot) return bucket;
+                bucket = (bucket + 1) & _mask;
+            }
+            return bucket;
+        }
+        std::size_t bucket_of(std::size_t position) const {
+            std::size_t bucket = _hashes[position] & _mask;
+            while (_index[bucket] != position + 1) bucket = (bucket + 1) & _mask;
+            return bucket;
+        }
+        // backward shift: later entries of the probe run move into the hole, no tombstones are left
+        void erase_bucket(std::size_t hole) {
+            for (std::size_t next = (hole + 1) & _mask; std::uint32_t entry = _index[next]; next = (next + 1) & _mask) {
+                std::size_t home = _hashes[entry - 1] & _mask;
+                if (((next - home) & _mask) >= ((next - hole) & _mask)) {
+                    _index[hole] = entry;
+                    hole = next;
+                }
+            }
+            _index[hole] = 0;
+        }
+        void rehash(std::size_t buckets) {
+            _index.assign(buckets, 0);
+            _mask = buckets - 1;
+            for (std::size_t i = 0; i < _slots.size(); ++i) {
+                std::size_t bucket = _hashes[i] & _mask;
+                while (_index[bucket]) bucket = (bucket + 1) & _mask;
+                _index[bucket] = static_cast<std::uint32_t>(i + 1);
+            }
+        }
+
+    public:
+        subscriber_set() : _index(8, 0), _mask(7) {}
+
+        // false for an empty slot, one equal to a connected slot (see callback::operator==), or one that is not
+        // callback::comparable(): no callback could ever disconnect it
+        bool connect(slot_t slot) {
+            if (!slot || !slot.comparable()) return false;
+            std::size_t hash = slot.hash();
+            std::size_t bucket = find(slot, hash);
+            if (_index[bucket]) return false;
+            if ((_slots.size() + 1) * 2 > _index.size()) {
+                rehash(_index.size() * 2);
+                bucket = find(slot, hash);
+            }
+            _slots.push_back(std::move(slot));
+            _hashes.push_back(hash);
+            _index[bucket] = static_cast<std::uint32_t>(_slots.size());
+            return true;
+        }
+        bool disconnect(const slot_t& slot) {
+            std::size_t bucket = find(slot, slot.hash());
+            std::uint32_t entry = _index[bucket];
+            if (!entry) return false;
+            erase_bucket(bucket);
+            std::size_t position = entry - 1, last = _slots.size() - 1;
+            if (position != last) {
+                _index[bucket_of(last)] = entry;
+                _slots[position] = std::move(_slots[last]);
+                _hashes[position] = _hashes[last];
+            }
+            _slots.pop_back();
+            _hashes.pop_back();
+            return true;
+        }
+        bool contains(const slot_t& slot) const { return _index[find(slot, slot.hash())] != 0; }
+        void clear() {
+            _slots.clear();
+            _hashes.clear();
+            std::fill(_index.begin(), _index.end(), 0u);
+        }
+
+        std::size_t size() const { return _slots.size(); }
+        bool empty() const { return _slots.empty(); }
+        const slot_t* data() const { return _slots.data(); }
+        const slot_t* begin() const { return _slots.data(); }
+        const slot_t* end() const { return _slots.data() + _slots.size(); }
+
+        // calls every slot, results are discarded. Slots must not connect or disconnect during the call
+        void emit(ARGS... args) const {
+            for (const slot_t& slot : _slots) slot(args...);
+        }
+        void operator()(ARGS... args) const { emit(args...); }
+    };
+}
+#endif
@@ -0,0 +1,69 @@
+/*
+ * Project Name: sy_callback.hpp
+ * Author: ShigamiYune
+ * Version: 1.6.1
+ * Copyright 2025 ShigamiYune
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+#ifndef SY_THREAD_IDS_HPP
+#define SY_THREAD_IDS_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace sy_callback {
+    // dense ids of the live threads: an exiting thread hands its id back, the next new thread reuses it,
+    // so every id stays below the peak number of live threads that asked for one. Shared by the per-thread
+    // shards of sharded_memoized and sharded_registry
+    class thread_ids {
+        std::mutex _mutex;
+        std::vector<std::size_t> _free;
+        std::size_t _next;
+
+        thread_ids() : _next(0) {}
+        static thread_ids& instance() {
+            static thread_ids ids;
+            return ids;
+        }
+
+        struct holder {
+            std::size_t id;
+            holder() : id(instance().acquire()) {}
+            ~holder() { instance().release(id); }
+        };
+
+        std::size_t acquire() {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_free.empty()) return _next++;
+            std::size_t id = _free.back();
+            _free.pop_back();
+            return id;
+        }
+        void release(std::size_t id) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _free.push_back(id);
+        }
+
+    public:
+        // the id of the calling thread, unique among the live threads
+        static std::size_t current() {
+            static thread_local holder self;
+            return self.id;
+        }
+    };
+}
+#endif
@@ -60,6 +60,7 @@ int main() {
 
     // ===== sy_callback =====
     auto cb_member_inline = sy_callback::callback<void()>::make<MyClass, &MyClass::member_func>(&obj);
+    auto cb_member_runtime = sy_callback::callback<void()>::make(&obj, &MyClass::member_func);
     auto cb_member_bind = std::bind(&MyClass::member_func, &obj);
     auto cb_global = sy_callback::callback<void()>::make(global_func);
     auto cb_lambda_no_capture = sy_callback::callback<void()>::make(lambda_no_capture);
@@ -73,6 +74,13 @@ int main() {
               << std::chrono::duration<double, std::milli>(end - start).count()
               << " ms\n";
 
+    start = std::chrono::high_resolution_clock::now();
+    for(int i = 0; i < N; ++i) cb_member_runtime();
+    end = std::chrono::high_resolution_clock::now();
+    std::cout << "sy_callback runtime_member_func: "
+              << std::chrono::duration<double, std::milli>(end - start).count()
+              << " ms\n";
+
     start = std::chrono::high_resolution_clock::now();
     for(int i = 0; i < N; ++i) cb_member_bind();
     end = std::chrono::high_resolution_clock::now();
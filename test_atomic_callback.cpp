@@ -0,0 +1,90 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include "sy_atomic_callback.hpp"
+
+using handler_t = sy_callback::callback<int(int)>;
+
+static handler_t make_handler(int value) {
+    std::vector<int> state(64, value);
+    return [state](int x) {
+        for (int v : state) if (v != state[0]) std::abort();
+        return state[0] + x;
+    };
+}
+
+template<typename FUNC>
+static double run_readers(int threads, int calls, FUNC read) {
+    std::vector<std::thread> workers;
+    std::atomic<long long> sum(0);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            long long local = 0;
+            for (int i = 0; i < calls; ++i) local += read(i);
+            sum += local;
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    auto end = std::chrono::high_resolution_clock::now();
+    if (sum.load() == 42) std::cout << "";
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    // ===== Stress: readers invoke while a writer keeps swapping targets =====
+    {
+        sy_callback::atomic_callback<int(int)> slot(make_handler(0));
+        std::atomic<bool> stop(false);
+        std::vector<std::thread> readers;
+        for (int t = 0; t < 4; ++t) {
+            readers.emplace_back([&]() {
+                while (!stop.load(std::memory_order_relaxed)) {
+                    int value = slot(0);
+                    if (value < 0 || value > 20000) std::abort();
+                    handler_t copy = slot.load();
+                    if (copy && copy(0) < 0) std::abort();
+                }
+            });
+        }
+        for (int i = 1; i <= 20000; ++i) {
+            if (i % 2) slot.store(make_handler(i));
+            else slot.exchange(make_handler(i));
+        }
+        stop = true;
+        for (auto& reader : readers) reader.join();
+        slot.collect();
+        std::cout << "atomic_callback stress: ok\n";
+    }
+
+    // ===== Read throughput =====
+    const int N = 2000000;
+    for (int threads : { 1, 2, 4, 8 }) {
+        sy_callback::atomic_callback<int(int)> slot(make_handler(1));
+        double ms = run_readers(threads, N, [&](int i) { return slot(i); });
+        std::cout << "atomic_callback " << threads << " thread(s): " << ms << " ms\n";
+
+        std::mutex mutex;
+        handler_t locked = make_handler(1);
+        ms = run_readers(threads, N, [&](int i) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return locked(i);
+        });
+        std::cout << "std::mutex + callback " << threads << " thread(s): " << ms << " ms\n";
+
+#if __cplusplus >= 202002L && defined(__cpp_lib_atomic_shared_ptr)
+        std::atomic<std::shared_ptr<handler_t>> shared(std::make_shared<handler_t>(make_handler(1)));
+        ms = run_readers(threads, N, [&](int i) { return (*shared.load())(i); });
+#else
+        std::shared_ptr<handler_t> shared = std::make_shared<handler_t>(make_handler(1));
+        ms = run_readers(threads, N, [&](int i) { return (*std::atomic_load(&shared))(i); });
+#endif
+        std::cout << "atomic shared_ptr " << threads << " thread(s): " << ms << " ms\n";
+    }
+
+    return 0;
+}
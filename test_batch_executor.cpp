@@ -0,0 +1,97 @@
+#include <iostream>
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "sy_batch_executor.hpp"
+
+using task_t = sy_callback::callback<void()>;
+
+// 30 distinct target types, so 30 distinct thunks, each callback updates its own entity
+template<int N>
+struct task {
+    unsigned long long* entity;
+    void operator()() const {
+        unsigned long long value = *entity;
+        for (int i = 0; i < N % 7 + 1; ++i) value = value * 31 + N;
+        *entity = value;
+    }
+};
+
+using factory_t = task_t(*)(unsigned long long*);
+template<int N> static task_t make_task(unsigned long long* entity) { return task<N>{ entity }; }
+
+static void add_types(std::vector<factory_t>& types, std::integral_constant<int, 0>) {
+    types.push_back(&make_task<0>);
+}
+template<int N>
+static void add_types(std::vector<factory_t>& types, std::integral_constant<int, N>) {
+    add_types(types, std::integral_constant<int, N - 1>());
+    types.push_back(&make_task<N>);
+}
+
+template<typename FUNC>
+static double measure(int rounds, FUNC func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    // ===== Ordering =====
+    {
+        std::vector<int> log;
+        std::vector<task_t> batch;
+        for (int i = 0; i < 12; ++i) {
+            if (i % 2) batch.push_back([&log, i]() { log.push_back(i); });
+            else batch.push_back([&log, i]() { log.push_back(100 + i); });
+        }
+
+        sy_callback::batch_executor<void()> stable;
+        stable.run(batch);
+        std::vector<int> expected = { 100, 102, 104, 106, 108, 110, 1, 3, 5, 7, 9, 11 };
+        if (log != expected) { std::cout << "stable order: failed\n"; return 1; }
+
+        log.clear();
+        stable.run(batch, std::vector<std::size_t>{ 4, 8 });
+        expected = { 100, 102, 1, 3, 104, 106, 5, 7, 108, 110, 9, 11 };
+        if (log != expected) { std::cout << "barrier order: failed\n"; return 1; }
+
+        std::cout << "batch_executor ordering: ok\n";
+    }
+
+    // ===== Benchmark: 50k callbacks of 30 target types, randomly interleaved =====
+    std::vector<factory_t> types;
+    add_types(types, std::integral_constant<int, 29>());
+
+    const std::size_t count = 50000;
+    std::vector<unsigned long long> entities(count, 1);
+    std::mt19937 random(42);
+    std::vector<task_t> batch;
+    for (std::size_t i = 0; i < count; ++i) batch.push_back(types[random() % types.size()](&entities[i]));
+
+    const int rounds = 200;
+    double ms = measure(rounds, [&]() { for (const task_t& cb : batch) cb(); });
+    std::vector<unsigned long long> naive = entities;
+    std::cout << "naive in-order: " << ms << " ms\n";
+
+    sy_callback::batch_executor<void()> executor;
+    for (std::size_t window : { std::size_t(0), std::size_t(512), std::size_t(2048), std::size_t(8192) }) {
+        executor.window(window);
+        entities.assign(count, 1);
+        ms = measure(rounds, [&]() { executor.run(batch); });
+        std::cout << "batch_executor, window " << window << ": " << ms << " ms\n";
+        if (entities != naive) { std::cout << "batch_executor result: failed\n"; return 1; }
+    }
+
+    std::vector<std::size_t> barriers;
+    for (std::size_t i = 1024; i < count; i += 1024) barriers.push_back(i);
+    executor.window(2048);
+    entities.assign(count, 1);
+    ms = measure(rounds, [&]() { executor.run(batch, barriers); });
+    std::cout << "batch_executor, barrier every 1024: " << ms << " ms\n";
+    if (entities != naive) { std::cout << "barrier result: failed\n"; return 1; }
+
+    return 0;
+}
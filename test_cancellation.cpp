@@ -0,0 +1,203 @@
+// g++ -std=c++11 -O2 -pthread test_cancellation.cpp -o test_cancellation
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include "sy_callback.hpp"
+#include "test_util.hpp"
+
+using task_t = sy_callback::callback<void(int)>;
+using wide_task_t = sy_callback::wide_callback<void(int)>;
+
+struct Session {
+    long long received = 0;
+    void on_data(int x) { received += x; }
+};
+
+// a functor too big to be stored inline, counts its live instances
+static int alive = 0;
+struct Buffer {
+    std::string data;
+    Buffer(std::string d) : data(std::move(d)) { ++alive; }
+    Buffer(const Buffer& other) : data(other.data) { ++alive; }
+    ~Buffer() { --alive; }
+    std::size_t operator()(std::size_t x) const { return x + data.size(); }
+};
+
+static int twice(int x) { return x * 2; }
+
+template<typename F>
+static double per_call(const std::vector<F>& tasks, int rounds) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r)
+        for (const F& task : tasks) task(r);
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(rounds) * tasks.size());
+}
+
+int main() {
+    // ===== Inline, no allocation, cancel stops the calls =====
+    {
+        sy_callback::cancellation_source source;
+        Session session;
+        Session* self = &session;
+        int weight = 2;
+        long long before = allocations.load();
+        wide_task_t task = wide_task_t::make_cancellable(source.token(), [self, weight](int x) { self->on_data(x * weight); });
+        wide_task_t copy = task;
+        CHECK(allocations.load() == before);
+
+        // a two-word callback keeps the target and the block in one node
+        task_t narrow = task_t::make_cancellable(source.token(), [self, weight](int x) { self->on_data(x * weight); });
+        CHECK(allocations.load() == before + 1);
+        narrow(0);
+
+        task(1);
+        copy(2);
+        CHECK(session.received == 6);
+        CHECK(task.isCallable() && !source.cancelled());
+
+        source.cancel();
+        CHECK(source.cancelled() && source.token().cancelled());
+        task(10);                           // does nothing
+        CHECK(session.received == 6);
+        CHECK(!task && !task.isCallable());
+        CHECK(!copy.isCallable());          // a copy sees the same flag
+        CHECK(!copy);
+        CHECK(task.release_expired() && !task.release_expired());
+        task(10);                           // released, still cancelled: still does nothing
+        CHECK(session.received == 6 && !task);
+        std::cout << "inline: ok\n";
+    }
+
+    // ===== Heap functors are released by non-const paths only =====
+    {
+        sy_callback::cancellation_source source;
+        sy_callback::callback<std::size_t(std::size_t)> a =
+            sy_callback::callback<std::size_t(std::size_t)>::make_cancellable(source.token(), Buffer("payload"));
+        sy_callback::callback<std::size_t(std::size_t)> b = a;
+        sy_callback::callback<std::size_t(std::size_t)> c = a;
+        CHECK(alive == 3);
+        CHECK(a(1) == 8 && b(2) == 9);
+        CHECK(!a.release_expired() && alive == 3);     // not cancelled: nothing to release
+
+        source.cancel();
+        CHECK(alive == 3);                  // cancel() itself is O(1), it does not visit the callbacks
+        bool thrown = false;
+        try { a(1); }
+        catch (const std::bad_function_call&) { thrown = true; }
+        CHECK(thrown);                      // nothing to return
+        CHECK(!a && !b.isCallable() && alive == 3);    // calls and checks only read the flag
+        CHECK(a.release_expired() && alive == 2 && !a);
+        b = sy_callback::callback<std::size_t(std::size_t)>();
+        CHECK(alive == 1);
+        c.reset();
+        CHECK(alive == 0);
+        std::cout << "release: ok\n";
+    }
+
+    // ===== Cancel while other threads call the same callback =====
+    {
+        sy_callback::cancellation_source source;
+        const sy_callback::callback<std::size_t(std::size_t)> shared =
+            sy_callback::callback<std::size_t(std::size_t)>::make_cancellable(source.token(), Buffer("payload"));
+        std::atomic<int> started(0);
+        std::atomic<long long> calls(0);
+        std::atomic<int> refused(0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&]() {
+                ++started;
+                for (;;) {             // until the cancellation is seen
+                    try { if (shared(1) == 8) ++calls; }
+                    catch (const std::bad_function_call&) { ++refused; break; }
+                }
+                if (!shared.isCallable()) ++refused;
+            });
+        }
+        while (started.load() != 4) std::this_thread::yield();
+        source.cancel();
+        for (std::thread& thread : threads) thread.join();
+        CHECK(refused == 8 && alive == 1 && !shared);
+        std::cout << "concurrent cancel: ok\n";
+    }
+    CHECK(alive == 0);
+
+    // ===== Tokens, sources and callbacks share one block =====
+    {
+        sy_callback::cancellation_token token;
+        CHECK(!token.cancelled());
+        sy_callback::callback<int(int)> plain = sy_callback::callback<int(int)>::make_cancellable(token, &twice);
+        CHECK(plain(3) == 6);               // an empty token never cancels
+
+        task_t outlived;
+        int calls = 0;
+        {
+            sy_callback::cancellation_source source;
+            sy_callback::cancellation_source other = source;
+            token = source.token();
+            outlived = task_t::make_cancellable(token, [&calls](int) { ++calls; });
+            other.cancel();
+            CHECK(source.cancelled());
+        }
+        CHECK(token.cancelled());
+        outlived(1);
+        CHECK(calls == 0 && !outlived);
+
+        sy_callback::callback<int(int)> pointer;
+        {
+            sy_callback::cancellation_source source;
+            pointer = sy_callback::callback<int(int)>::make_cancellable(source.token(), &twice);
+            task_t wrapped = task_t::make_cancellable(source.token(), task_t([&calls](int x) { calls += x; }));
+            wrapped(4);
+            CHECK(calls == 4);
+        }
+        CHECK(pointer(5) == 10);            // the sources are gone but nobody cancelled
+        std::cout << "tokens: ok\n";
+    }
+
+    // ===== Benchmark: group cancel against shared_ptr<bool> captures =====
+    {
+        const int callbacks = 10000, rounds = 200;
+        Session session;
+        Session* self = &session;
+
+        long long before = allocations.load();
+        sy_callback::cancellation_source source;
+        std::vector<wide_task_t> tokens;
+        tokens.reserve(callbacks);
+        for (int i = 0; i < callbacks; ++i)
+            tokens.push_back(wide_task_t::make_cancellable(source.token(), [self](int x) { self->on_data(x); }));
+        long long token_allocations = allocations.load() - before;
+
+        before = allocations.load();
+        std::shared_ptr<bool> alive_flag = std::make_shared<bool>(true);
+        std::vector<task_t> shared;
+        shared.reserve(callbacks);
+        for (int i = 0; i < callbacks; ++i)
+            shared.push_back([self, alive_flag](int x) { if (*alive_flag) self->on_data(x); });
+        long long shared_allocations = allocations.load() - before;
+
+        double token_ns = per_call(tokens, rounds);
+        double shared_ns = per_call(shared, rounds);
+        CHECK(session.received == 2LL * callbacks * (rounds * (rounds - 1) / 2));
+
+        auto start = std::chrono::high_resolution_clock::now();
+        source.cancel();
+        auto end = std::chrono::high_resolution_clock::now();
+        *alive_flag = false;
+        for (const wide_task_t& task : tokens) CHECK(!task.isCallable());
+
+        std::cout << callbacks << " callbacks, cancellation token: " << token_allocations << " allocations, "
+                  << token_ns << " ns/call; shared_ptr<bool>: " << shared_allocations << " allocations, "
+                  << shared_ns << " ns/call; cancel(): "
+                  << std::chrono::duration<double, std::nano>(end - start).count() << " ns\n";
+    }
+    return 0;
+}
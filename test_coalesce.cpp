@@ -0,0 +1,141 @@
+// g++ -std=c++11 -O2 -pthread test_coalesce.cpp -o test_coalesce
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "sy_coalesce.hpp"
+#include "test_util.hpp"
+
+// manual clock: tests move time by hand
+struct test_clock {
+    using duration = std::chrono::microseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<test_clock>;
+    static const bool is_steady = true;
+
+    static long long ticks;
+    static time_point now() { return time_point(duration(ticks)); }
+};
+long long test_clock::ticks = 0;
+
+struct Quote {
+    int symbol;
+    double price;
+};
+
+struct Sink {
+    int calls = 0;
+    int symbol = 0;
+    double price = 0;
+    void on_quote(int s, double p) { ++calls; symbol = s; price = p; }
+};
+
+using quote_cb = sy_callback::callback<void(int, double)>;
+
+int main() {
+    // ===== Latest value wins =====
+    {
+        Sink sink;
+        sy_callback::latest<void(int, double)> latest(quote_cb::make<Sink, &Sink::on_quote>(&sink));
+        long long before = allocations.load();
+        for (int i = 0; i < 1000; ++i) latest.post(7, i * 0.5);
+        CHECK(allocations.load() == before);
+        CHECK(latest.flush() && sink.calls == 1 && sink.price == 999 * 0.5);
+        CHECK(!latest.flush() && sink.calls == 1);
+        std::cout << "latest: ok\n";
+    }
+
+    // ===== Debounce =====
+    {
+        Sink sink;
+        sy_callback::debounce<void(int, double), test_clock> debounced(
+            quote_cb::make<Sink, &Sink::on_quote>(&sink), std::chrono::microseconds(100));
+        test_clock::ticks = 0;
+        for (int i = 0; i < 10; ++i) {
+            debounced.post(1, i);
+            test_clock::ticks += 50;        // posts keep coming inside the quiet period
+            CHECK(!debounced.poll());
+        }
+        test_clock::ticks += 60;
+        CHECK(debounced.poll() && sink.calls == 1 && sink.price == 9);
+        CHECK(!debounced.poll());
+        std::cout << "debounce: ok\n";
+    }
+
+    // ===== Throttle =====
+    {
+        Sink sink;
+        sy_callback::throttle<void(int, double), test_clock> throttled(
+            quote_cb::make<Sink, &Sink::on_quote>(&sink), std::chrono::microseconds(100));
+        test_clock::ticks = 1000;
+        throttled.post(1, 1.0);                     // leading call goes through
+        CHECK(sink.calls == 1 && !throttled.pending());
+        for (int i = 2; i <= 5; ++i) {
+            test_clock::ticks += 10;
+            throttled.post(1, i);                   // held back, latest wins
+        }
+        CHECK(sink.calls == 1 && !throttled.poll());
+        test_clock::ticks = 1100;
+        CHECK(throttled.poll() && sink.calls == 2 && sink.price == 5.0);
+        test_clock::ticks = 1150;
+        throttled.post(1, 6.0);                     // inside the new interval
+        CHECK(sink.calls == 2 && throttled.flush() && sink.price == 6.0);
+        std::cout << "throttle: ok\n";
+    }
+
+    // ===== Producer / consumer handoff =====
+    {
+        Sink sink;
+        sy_callback::latest_handoff<void(int, double)> handoff(quote_cb::make<Sink, &Sink::on_quote>(&sink));
+        const int N = 1000000;
+        std::atomic<bool> done(false);
+        long long before = allocations.load();
+        double last_seen = -1;
+        bool ordered = true;
+
+        auto start = std::chrono::high_resolution_clock::now();
+        std::thread producer([&]() {
+            for (int i = 0; i < N; ++i) handoff.post(i, i);
+            done.store(true, std::memory_order_release);
+        });
+        for (;;) {
+            bool finished = done.load(std::memory_order_acquire);
+            if (handoff.flush()) {
+                if (sink.price <= last_seen || sink.symbol != static_cast<int>(sink.price)) ordered = false;
+                last_seen = sink.price;
+            }
+            else if (finished) break;
+            else std::this_thread::yield();
+        }
+        producer.join();
+        auto end = std::chrono::high_resolution_clock::now();
+
+        CHECK(ordered);
+        CHECK(sink.price == N - 1);
+        CHECK(allocations.load() - before <= 1);    // std::thread's own state
+        std::cout << "handoff: ok, " << N << " posts coalesced into " << sink.calls << " calls in "
+                  << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+    }
+
+    // ===== Cost of a post =====
+    {
+        const int N = 20000000;
+        Sink sink;
+        quote_cb direct = quote_cb::make<Sink, &Sink::on_quote>(&sink);
+        sy_callback::latest<void(int, double)> latest(direct);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < N; ++i) direct(i, i);
+        auto mid = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < N; ++i) {
+            latest.post(i, i);
+            if ((i & 1023) == 0) latest.flush();
+        }
+        latest.flush();
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "direct call: " << std::chrono::duration<double, std::nano>(mid - start).count() / N << " ns, "
+                  << "latest post: " << std::chrono::duration<double, std::nano>(end - mid).count() / N << " ns\n";
+    }
+    return 0;
+}
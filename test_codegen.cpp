@@ -0,0 +1,51 @@
+// representative call sites for test_codegen.sh: every extern "C" function below is
+// disassembled and checked against the limits listed in the script
+#include "sy_callback.hpp"
+
+using callback_t = sy_callback::callback<int(int)>;
+using multi_t = sy_callback::multi_callback<int(int), int(double)>;
+
+struct Counter {
+    int base;
+    int add(int x) { return base + x; }
+    int get(int x) const { return base * x; }
+};
+
+struct Adder {
+    int step;
+    int operator()(int x) const { return x + step; }
+};
+
+int free_function(int x);
+int free_function(int x) { return x * 3; }
+
+extern "C" {
+    // the generic call path: whatever the target, one call through the stored thunk
+    int codegen_operator_call(const callback_t& cb, int x) { return cb(x); }
+    int codegen_invoke(const callback_t& cb, int x) { return cb.invoke(x); }
+    // any signature of a multi_callback: one load from its thunk table, one indirect call
+    int codegen_multi_call(const multi_t& cb, double x) { return cb(x); }
+
+    // predicted calls: a direct call when the guess is right, the generic path otherwise
+    int codegen_predict_member(callback_t& cb, int x) { return cb.invoke_prediction<Counter, &Counter::add>(x); }
+    int codegen_predict_any(callback_t& cb, int x) { return cb.invoke_prediction<Adder>(x); }
+    int codegen_predict_pointer(callback_t& cb, int x) { return cb.invoke_prediction<int(*)(int)>(x); }
+
+    // construction and call in one place: the target is known, nothing may allocate
+    int codegen_member_target(Counter& counter, int x) { return callback_t::make<Counter, &Counter::add>(&counter)(x); }
+    int codegen_const_member_target(const Counter& counter, int x) {
+        return callback_t::make<Counter, &Counter::get>(&counter)(x);
+    }
+    int codegen_free_target(int x) { return callback_t::make<&free_function>()(x); }
+    int codegen_pointer_target(int (*func)(int), int x) { return callback_t(func)(x); }
+    int codegen_lambda_target(int x) {
+        callback_t cb = [](int value) { return value + 1; };
+        return cb(x);
+    }
+
+    // copy and move of a callback with an inline target
+    int codegen_move(callback_t& cb, int x) {
+        callback_t moved = std::move(cb);
+        return moved(x);
+    }
+}
@@ -0,0 +1,68 @@
+#!/bin/sh
+# Codegen regression test: compiles test_codegen.cpp at -O2 with every compiler found
+# (g++, clang++, or the ones listed in $CXX), disassembles it with objdump and checks every
+# call site against its limits: instruction count, indirect branches, calls to operator new.
+#     ./test_codegen.sh                 CXX="g++-13 clang++-17" ./test_codegen.sh
+# exits 1 when a limit is exceeded, the disassembly of that function is printed
+cd "$(dirname "$0")" || exit 1
+
+# function                          max instructions    max indirect branches
+# pointer_target builds and destroys a callback from a runtime pointer: the second indirect
+# branch is the life call of the destructor, skipped at run time for trivial targets
+LIMITS="
+codegen_operator_call               4                   1
+codegen_invoke                      4                   1
+codegen_multi_call                  4                   1
+codegen_predict_member              14                  1
+codegen_predict_any                 14                  1
+codegen_predict_pointer             14                  2
+codegen_member_target               4                   0
+codegen_const_member_target         4                   0
+codegen_free_target                 4                   0
+codegen_pointer_target              30                  2
+codegen_lambda_target               4                   0
+codegen_move                        40                  2
+"
+
+: "${CXX:=$(for c in g++ clang++; do command -v "$c" >/dev/null 2>&1 && printf '%s ' "$c"; done)}"
+if [ -z "$CXX" ]; then echo "test_codegen: no compiler found"; exit 1; fi
+if ! command -v objdump >/dev/null 2>&1; then echo "test_codegen: objdump not found"; exit 1; fi
+
+work=$(mktemp -d) || exit 1
+trap 'rm -rf "$work"' EXIT
+status=0
+
+for cxx in $CXX; do
+    for std in c++11 c++17; do
+        if ! $cxx -std=$std -O2 -c test_codegen.cpp -o "$work/codegen.o"; then
+            echo "$cxx -std=$std: build failed"; status=1; continue
+        fi
+        objdump -d -r --no-show-raw-insn "$work/codegen.o" > "$work/codegen.s"
+
+        echo "$LIMITS" | while read -r name max_instructions max_indirect; do
+            [ -z "$name" ] && continue
+            # body of the function: from its label to the next blank line, padding nops left out
+            awk -v name="$name" '
+                $0 ~ "<" name ">:$" { inside = 1; next }
+                inside && /^$/      { exit }
+                inside              { print }
+            ' "$work/codegen.s" > "$work/body"
+            if [ ! -s "$work/body" ]; then echo "$cxx -std=$std $name: not found"; echo 1 > "$work/failed"; continue; fi
+
+            instructions=$(grep -v 'R_X86_64\|R_AARCH64\|nop\|xchg *%ax,%ax' "$work/body" | grep -c ':')
+            indirect=$(grep -c '\(call\|jmp\)q\? *\*\|bl\?r ' "$work/body")
+            allocations=$(grep -c '_Znwm\|_Znwj\|operator new' "$work/body")
+
+            if [ "$instructions" -gt "$max_instructions" ] || [ "$indirect" -gt "$max_indirect" ] || [ "$allocations" -ne 0 ]; then
+                echo "$cxx -std=$std $name: failed, $instructions instructions (max $max_instructions)," \
+                     "$indirect indirect branches (max $max_indirect), $allocations operator new"
+                cat "$work/body"
+                echo 1 > "$work/failed"
+            else
+                echo "$cxx -std=$std $name: ok, $instructions instructions, $indirect indirect"
+            fi
+        done
+        [ -f "$work/failed" ] && status=1
+    done
+done
+exit $status
@@ -0,0 +1,80 @@
+#!/bin/sh
+# Compile-time benchmark: generates one translation unit with N distinct callback signatures,
+# each bound to a member function, a const member function, a function pointer and a lambda,
+# then reports compile time (whole build with $FLAGS, -O2 by default, and the front end alone)
+# and object size for every compiler and language mode.
+#     ./test_compile_time.sh            N=3000 CXX="g++ clang++" STDS="c++11 c++20" FLAGS=-O0 ./test_compile_time.sh
+# set BASELINE to another copy of sy_callback.hpp to print both side by side,
+# ./test_compile_time.sh --source prints the generated translation unit
+cd "$(dirname "$0")" || exit 1
+
+: "${N:=500}"
+: "${STDS:=c++11 c++17 c++20}"
+: "${FLAGS:=-O2}"
+: "${CXX:=$(for c in g++ clang++; do command -v "$c" >/dev/null 2>&1 && printf '%s ' "$c"; done)}"
+if [ -z "$CXX" ]; then echo "test_compile_time: no compiler found"; exit 1; fi
+
+generate() {
+    echo '#include "sy_callback.hpp"'
+    echo 'using namespace sy_callback;'
+    i=0
+    while [ $i -lt "$N" ]; do
+        cat <<EOF
+struct arg_$i { int value; };
+struct target_$i {
+    int base;
+    int add(arg_$i a) { return base + a.value; }
+    int get(arg_$i a) const { return base - a.value; }
+};
+static int free_$i(arg_$i a) { return a.value * 2; }
+int use_$i(target_$i& t, int x) {
+    callback<int(arg_$i)> member = callback<int(arg_$i)>::make<target_$i, &target_$i::add>(&t);
+    callback<int(arg_$i)> constant = callback<int(arg_$i)>::make<target_$i, &target_$i::get>(&t);
+    callback<int(arg_$i)> pointer = &free_$i;
+    callback<int(arg_$i)> lambda = [x](arg_$i a) { return a.value + x; };
+    arg_$i a = { x };
+    return member(a) + constant(a) + pointer(a) + lambda(a) + member.invoke_prediction<target_$i, &target_$i::add>(a);
+}
+EOF
+        i=$((i + 1))
+    done
+}
+
+if [ "$1" = "--source" ]; then generate; exit 0; fi
+
+work=$(mktemp -d) || exit 1
+trap 'rm -rf "$work"' EXIT
+
+# $1: compiler, $2: standard, $3: directory; prints "seconds front-end-seconds bytes"
+seconds_of() {
+    start=$(date +%s.%N)
+    "$@" 2> "$work/errors" || { head -n 20 "$work/errors" >&2; return 1; }
+    end=$(date +%s.%N)
+    echo "$start $end" | awk '{ printf "%.2f", $2 - $1 }'
+}
+measure() {
+    front=$(seconds_of $1 -std=$2 -I"$3" -fsyntax-only "$work/bench.cpp") || { echo "failed - -"; return; }
+    total=$(seconds_of $1 -std=$2 $FLAGS -I"$3" -c "$work/bench.cpp" -o "$work/bench.o") || { echo "failed - -"; return; }
+    bytes=$(size "$work/bench.o" 2>/dev/null | awk 'NR == 2 { print $4 }')
+    echo "$total $front ${bytes:-$(wc -c < "$work/bench.o")}"
+}
+
+generate > "$work/bench.cpp"
+if [ -n "$BASELINE" ]; then
+    mkdir -p "$work/baseline"
+    cp "$BASELINE" "$work/baseline/sy_callback.hpp"
+    printf '%-10s %-8s %8s %10s %12s   %8s %10s %12s\n' compiler std seconds "front end" "object size" baseline "front end" "object size"
+else
+    printf '%-10s %-8s %8s %10s %12s\n' compiler std seconds "front end" "object size"
+fi
+
+for cxx in $CXX; do
+    for std in $STDS; do
+        if [ -n "$BASELINE" ]; then
+            printf '%-10s %-8s %8s %10s %12s   %8s %10s %12s\n' "$cxx" "$std" $(measure "$cxx" "$std" .) $(measure "$cxx" "$std" "$work/baseline")
+        else
+            printf '%-10s %-8s %8s %10s %12s\n' "$cxx" "$std" $(measure "$cxx" "$std" .)
+        fi
+    done
+done
+echo "$N signatures, $FLAGS"
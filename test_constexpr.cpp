@@ -0,0 +1,71 @@
+#include <iostream>
+#include "sy_callback.hpp"
+#include "test_util.hpp"
+
+using callback_t = sy_callback::callback<int(int)>;
+
+static int add_one(int x) { return x + 1; }
+static int add_two(int x) noexcept { return x + 2; }
+
+struct Unit {
+    int base;
+    int add(int x) const { return base + x; }
+};
+static Unit unit = { 10 };
+
+// the table is defined after a dynamically initialized global that already calls it:
+// this only works when the table was constant-initialized, before any startup code ran
+extern callback_t table[4];
+static int early = table[0](1) + table[1](1) + (table[3] ? 100 : 0);
+
+callback_t table[4] = {
+    callback_t(&add_one),
+    callback_t(&add_two),
+#if __cplusplus >= 201703L
+    callback_t([](int x) { return x * 3; }),       // stateless lambda: constexpr conversion since C++17
+#else
+    callback_t(&add_one),
+#endif
+    callback_t(),
+};
+
+#if __cplusplus >= 202002L
+// C++20: make() is constexpr as well, a constexpr table needs no startup code at all
+constinit callback_t member = callback_t::make<Unit, &Unit::add>(&unit);
+constexpr callback_t rodata[] = {
+    callback_t::make<&add_one>(),
+    callback_t::make<Unit, &Unit::add>(&unit),
+    callback_t(),
+};
+static_assert((callback_t::make<Unit, &Unit::add>(&unit), true), "built and destroyed at compile time");
+#endif
+
+int main() {
+    CHECK(early == 5);
+    CHECK(table[0](1) == 2);
+    CHECK(table[1](1) == 3);
+#if __cplusplus >= 201703L
+    CHECK(table[2](2) == 6);
+#endif
+    CHECK(!table[3]);
+    CHECK(table[0].target<int(*)(int)>() == &add_one);
+    callback_t bound = callback_t::make<Unit, &Unit::add>(&unit);
+    CHECK(bound(1) == 11);
+
+    // constant-initialized callbacks behave like any other: copy, reassign, reset
+    callback_t copy = table[0];
+    CHECK(copy(5) == 6);
+    table[0] = &add_two;
+    CHECK(table[0](5) == 7);
+    table[0].reset();
+    CHECK(!table[0]);
+
+#if __cplusplus >= 202002L
+    CHECK(member(1) == 11);
+    CHECK(rodata[0](1) == 2);
+    CHECK(rodata[1](2) == 12);
+    CHECK(!rodata[2]);
+#endif
+    std::cout << "constexpr: ok\n";
+    return 0;
+}
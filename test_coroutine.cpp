@@ -0,0 +1,131 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include "sy_coroutine.hpp"
+#include "test_util.hpp"
+
+// a fake I/O layer: keeps the pending completion until the driver delivers a value
+template<typename SLOT> static SLOT pending;
+
+// the bridges used before: same protocol as completion_awaiter, the slot holds a lambda
+// capturing the awaiter and the handle (std::function, or a callback that stores the lambda on the heap)
+template<typename SLOT>
+struct bridge_awaiter {
+    int value = 0;
+    std::atomic<int> state{ 0 };
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle) {
+        pending<SLOT> = SLOT([this, handle](int v) {
+            value = v;
+            if (state.exchange(2, std::memory_order_acq_rel) == 1) handle.resume();
+        });
+        return state.exchange(1, std::memory_order_acq_rel) != 2;
+    }
+    int await_resume() const noexcept { return value; }
+};
+
+using slot_t = sy_callback::callback<void(int)>;
+
+static sy_callback::task<long long> read_loop(int count) {
+    long long sum = 0;
+    for (int i = 0; i < count; ++i)
+        sum += co_await sy_callback::completion<int>([](slot_t done) { pending<slot_t> = std::move(done); });
+    co_return sum;
+}
+template<typename SLOT>
+static sy_callback::task<long long> read_loop_bridge(int count) {
+    long long sum = 0;
+    for (int i = 0; i < count; ++i) sum += co_await bridge_awaiter<SLOT>{};
+    co_return sum;
+}
+
+template<typename SLOT, typename TASK>
+static void measure(const char* name, TASK t, int count) {
+    t.start();
+    long long before = allocations;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < count; ++i) {
+        SLOT done = std::move(pending<SLOT>);
+        done(i);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    long long used = allocations - before;
+    if (!t.done() || t.result() != (long long)count * (count - 1) / 2) { std::cout << name << ": failed\n"; std::exit(1); }
+    std::cout << name << ": " << std::chrono::duration<double, std::nano>(end - start).count() / count
+              << " ns per resume, " << used << " allocations\n";
+}
+
+static sy_callback::task<int> immediate() {
+    int a = co_await sy_callback::completion<int>([](slot_t done) { done(20); });
+    co_await sy_callback::completion<void>([](sy_callback::callback<void()> done) { done(); });
+    co_return a + 1;
+}
+static sy_callback::task<int> nested() {
+    int value = co_await immediate();
+    co_return value * 2;
+}
+static sy_callback::task<std::string> from_thread(std::thread& worker) {
+    co_return co_await sy_callback::completion<std::string>([&](sy_callback::callback<void(std::string)> done) {
+        worker = std::thread([done]() { done("from worker"); });
+    });
+}
+static sy_callback::task<> failing() {
+    co_await sy_callback::completion<void>([](sy_callback::callback<void()> done) { done(); });
+    throw std::runtime_error("io");
+}
+
+static sy_callback::callback<void()> parked;
+struct park {
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> handle) { parked = sy_callback::resume_callback(handle); }
+    void await_resume() const noexcept {}
+};
+static sy_callback::task<> parking(bool& resumed) {
+    co_await park{};
+    resumed = true;
+}
+
+int main() {
+    // ===== Behaviour =====
+    {
+        auto t = nested();
+        t.start();
+        if (!t.done() || t.result() != 42) { std::cout << "nested task: failed\n"; return 1; }
+
+        std::thread worker;
+        auto s = from_thread(worker);
+        s.start();
+        worker.join();
+        if (!s.done() || s.result() != "from worker") { std::cout << "cross-thread completion: failed\n"; return 1; }
+
+        auto f = failing();
+        f.start();
+        bool caught = false;
+        try { f.result(); }
+        catch (const std::runtime_error&) { caught = true; }
+        if (!caught) { std::cout << "task exception: failed\n"; return 1; }
+
+        bool resumed = false;
+        auto p = parking(resumed);
+        long long before = allocations;
+        p.start();
+        if (allocations != before || resumed || p.done()) { std::cout << "resume_callback: failed\n"; return 1; }
+        parked();
+        if (!resumed || !p.done()) { std::cout << "resume_callback: failed\n"; return 1; }
+
+        std::cout << "coroutine completion: ok\n";
+    }
+
+    // ===== Resume latency =====
+    const int N = 2'000'000;
+    measure<slot_t>("sy_callback completion", read_loop(N), N);
+    measure<std::function<void(int)>>("std::function bridge", read_loop_bridge<std::function<void(int)>>(N), N);
+    measure<slot_t>("heap lambda callback bridge", read_loop_bridge<slot_t>(N), N);
+    return 0;
+}
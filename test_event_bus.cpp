@@ -0,0 +1,208 @@
+// g++ -std=c++11 -O2 test_event_bus.cpp -o test_event_bus
+#include <iostream>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+#include "sy_event_bus.hpp"
+#include "test_util.hpp"
+
+struct Opened { int id; };
+struct Closed { int id; std::string reason; };
+struct Tick { long long time; };
+
+using bus_t = sy_callback::event_bus<Opened, Closed, Tick>;
+
+struct Journal {
+    std::vector<std::string> lines;
+    void on_opened(const Opened& e) { lines.push_back("opened " + std::to_string(e.id)); }
+    void on_closed(const Closed& e) { lines.push_back("closed " + std::to_string(e.id) + " " + e.reason); }
+};
+
+// ===== Benchmark: 200 event types =====
+template<int N> struct Event { int value; };
+
+template<int N, typename... T> struct make_bus { using type = typename make_bus<N - 1, Event<N - 1>, T...>::type; };
+template<typename... T> struct make_bus<0, T...> { using type = sy_callback::event_bus<T...>; };
+using big_bus_t = make_bus<200>::type;
+
+// the design being replaced: one hash lookup and one unchecked cast per publish
+struct hash_bus {
+    std::unordered_map<std::type_index, std::vector<sy_callback::callback<void(const void*)>>> handlers;
+
+    template<typename EVENT>
+    void subscribe(sy_callback::callback<void(const void*)> handler) {
+        handlers[std::type_index(typeid(EVENT))].push_back(std::move(handler));
+    }
+    template<typename EVENT>
+    void publish(const EVENT& event) const {
+        auto it = handlers.find(std::type_index(typeid(EVENT)));
+        if (it == handlers.end()) return;
+        for (const auto& handler : it->second) handler(&event);
+    }
+};
+
+static long long total = 0;
+template<int N> static void count(const Event<N>& e) { total += e.value; }
+template<int N> static void count_erased(const void* e) { total += static_cast<const Event<N>*>(e)->value; }
+
+template<typename F>
+static double per_publish(F publish, int n) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < n; ++i) publish(i);
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / n;
+}
+
+template<int N> static void subscribe_both(big_bus_t& bus, hash_bus& hashed) {
+    bus.subscribe<Event<N>>(&count<N>);
+    hashed.subscribe<Event<N>>(&count_erased<N>);
+}
+
+int main() {
+    // ===== Typed publish, priorities =====
+    {
+        bus_t bus;
+        Journal journal;
+        std::vector<int> order;
+        bus.subscribe<Opened>(bus_t::handler_t<Opened>::make<Journal, &Journal::on_opened>(&journal));
+        bus.subscribe<Closed>(bus_t::handler_t<Closed>::make<Journal, &Journal::on_closed>(&journal));
+        bus.subscribe<Tick>([&order](const Tick&) { order.push_back(0); });
+        bus.subscribe<Tick>([&order](const Tick&) { order.push_back(10); }, 10);
+        bus.subscribe<Tick>([&order](const Tick&) { order.push_back(-1); }, -1);
+        bus.subscribe<Tick>([&order](const Tick&) { order.push_back(1); });
+        CHECK(bus.size<Tick>() == 4 && bus.size<Opened>() == 1);
+        CHECK(bus.subscribe<Tick>(bus_t::handler_t<Tick>()) == 0);
+
+        bus.publish(Opened{ 7 });
+        bus.publish(Closed{ 7, "done" });
+        bus.publish(Tick{ 1 });
+        CHECK(journal.lines.size() == 2 && journal.lines[1] == "closed 7 done");
+        CHECK((order == std::vector<int>{ 10, 0, 1, -1 }));
+        std::cout << "publish: ok\n";
+    }
+
+    // ===== Unsubscribe by connection =====
+    {
+        bus_t bus;
+        int opened = 0, ticks = 0;
+        bus_t::connection_t a = bus.subscribe<Opened>([&opened](const Opened&) { ++opened; });
+        bus_t::connection_t b = bus.subscribe<Tick>([&ticks](const Tick&) { ++ticks; });
+        CHECK(a != b && a != 0);
+        CHECK(bus.unsubscribe(a));
+        CHECK(!bus.unsubscribe(a));
+        CHECK(!bus.unsubscribe(0));
+        bus.publish(Opened{ 1 });
+        bus.publish(Tick{ 1 });
+        CHECK(opened == 0 && ticks == 1);
+        bus.clear();
+        CHECK(bus.empty<Tick>());
+        std::cout << "unsubscribe: ok\n";
+    }
+
+    // ===== Deferred queues keep the posting order across types =====
+    {
+        bus_t bus;
+        std::vector<std::string> seen;
+        bus.subscribe<Opened>([&](const Opened& e) {
+            seen.push_back("opened " + std::to_string(e.id));
+            if (e.id == 2) bus.post(Closed{ 2, "chained" });    // dispatched by the same call
+        });
+        bus.subscribe<Closed>([&](const Closed& e) { seen.push_back(e.reason); });
+        bus.subscribe<Tick>([&](const Tick& e) { seen.push_back("tick " + std::to_string(e.time)); });
+
+        bus.post(Opened{ 1 });
+        bus.post(Tick{ 5 });
+        Closed closed = { 1, "bye" };
+        bus.post(closed);
+        bus.post(Opened{ 2 });
+        CHECK(bus.pending() == 4 && seen.empty());
+        CHECK(bus.dispatch() == 5);
+        CHECK((seen == std::vector<std::string>{ "opened 1", "tick 5", "bye", "opened 2", "chained" }));
+        CHECK(bus.pending() == 0 && bus.dispatch() == 0);
+
+        bus.post(Tick{ 6 });
+        bus.discard();
+        CHECK(bus.dispatch() == 0 && seen.size() == 5);
+        std::cout << "deferred: ok\n";
+    }
+
+    // ===== A throwing handler consumes its event, dispatch() resumes after it =====
+    {
+        bus_t bus;
+        std::vector<std::string> seen;
+        bus.subscribe<Opened>([&](const Opened& e) {
+            if (e.id < 0) throw std::runtime_error("rejected");
+            seen.push_back("opened " + std::to_string(e.id));
+        });
+        bus.subscribe<Tick>([&](const Tick& e) { seen.push_back("tick " + std::to_string(e.time)); });
+
+        bus.post(Opened{ 1 });
+        bus.post(Opened{ -1 });
+        bus.post(Tick{ 7 });
+        bus.post(Opened{ 2 });
+        bool thrown = false;
+        try { bus.dispatch(); }
+        catch (const std::runtime_error&) { thrown = true; }
+        CHECK(thrown && bus.pending() == 2);
+        CHECK((seen == std::vector<std::string>{ "opened 1" }));
+
+        bus.post(Opened{ 3 });
+        CHECK(bus.dispatch() == 3 && bus.pending() == 0);
+        CHECK((seen == std::vector<std::string>{ "opened 1", "tick 7", "opened 2", "opened 3" }));
+
+        // the queues start over empty
+        bus.post(Opened{ 4 });
+        CHECK(bus.dispatch() == 1 && seen.back() == "opened 4" && seen.size() == 5);
+
+        bus.post(Opened{ -2 });
+        bus.post(Opened{ 5 });
+        thrown = false;
+        try { bus.dispatch(); }
+        catch (const std::runtime_error&) { thrown = true; }
+        CHECK(thrown && bus.pending() == 1);
+        bus.discard();
+        CHECK(bus.pending() == 0 && bus.dispatch() == 0 && seen.size() == 5);
+        std::cout << "throwing handler: ok\n";
+    }
+
+    // ===== Benchmark: typed bus against a type_index hash map =====
+    {
+        big_bus_t bus;
+        hash_bus hashed;
+        subscribe_both<0>(bus, hashed);
+        subscribe_both<57>(bus, hashed);
+        subscribe_both<101>(bus, hashed);
+        subscribe_both<199>(bus, hashed);
+        const int N = 2000000;
+
+        total = 0;
+        double typed = per_publish([&bus](int i) {
+            bus.publish(Event<0>{ i }); bus.publish(Event<57>{ i });
+            bus.publish(Event<101>{ i }); bus.publish(Event<199>{ i });
+        }, N) / 4;
+        long long typed_total = total;
+
+        total = 0;
+        double hash = per_publish([&hashed](int i) {
+            hashed.publish(Event<0>{ i }); hashed.publish(Event<57>{ i });
+            hashed.publish(Event<101>{ i }); hashed.publish(Event<199>{ i });
+        }, N) / 4;
+        CHECK(total == typed_total);
+
+        total = 0;
+        double deferred = per_publish([&bus](int i) {
+            bus.post(Event<0>{ i }); bus.post(Event<57>{ i });
+            bus.post(Event<101>{ i }); bus.post(Event<199>{ i });
+            if ((i & 255) == 255) bus.dispatch();
+        }, N) / 4;
+        bus.dispatch();
+        CHECK(total == typed_total);
+
+        std::cout << big_bus_t::event_count << " event types, event_bus: " << typed << " ns/publish, "
+                  << "post + dispatch: " << deferred << " ns/event, type_index hash map: " << hash << " ns/publish\n";
+    }
+    return 0;
+}
@@ -0,0 +1,162 @@
+// g++ -std=c++11 -O2 test_function_interop.cpp -o test_function_interop
+#include <iostream>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include "sy_callback.hpp"
+#include "test_util.hpp"
+
+using callback_t = sy_callback::callback<int(int)>;
+using function_t = std::function<int(int)>;
+
+static int twice(int x) { return x * 2; }
+static int negate(int x) noexcept { return -x; }
+
+// too big for the small buffer of std::function and for the inline storage of callback
+struct Offset {
+    int value;
+    long long padding[6];
+    int operator()(int x) const { return x + value; }
+};
+struct Unique {
+    std::unique_ptr<int> value;
+    int operator()(int x) const { return x + *value; }
+};
+
+// the old way to cross the boundary: one more wrapper, one more allocation and one more indirect call per hop
+static callback_t wrap(const function_t& func) { return [func](int x) { return func(x); }; }
+static function_t wrap(const callback_t& func) { return [func](int x) { return func(x); }; }
+
+template<typename F>
+static double per_call(F& func, int n) {
+    volatile unsigned sink = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < n; ++i) sink = sink + static_cast<unsigned>(func(i));
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / n;
+}
+
+int main() {
+    // ===== std::function -> callback: function pointers are unwrapped =====
+    {
+        function_t func = &twice;
+        long long before = allocations.load();
+        callback_t cb = func;
+        CHECK(allocations.load() == before);
+        CHECK(cb.target<int(*)(int)>() == &twice);
+        CHECK(cb(4) == 8);
+
+        cb = function_t(&twice);
+        CHECK(cb.target<int(*)(int)>() == &twice);
+        callback_t empty = function_t();
+        CHECK(!empty);
+#if __cplusplus >= 201703L
+        callback_t no_throw = function_t(&negate);
+        CHECK(no_throw.target<int(*)(int) noexcept>() == &negate);
+        CHECK(no_throw(3) == -3);
+        CHECK(cb.target<int(*)(int) noexcept>() == nullptr);
+#else
+        CHECK(negate(3) == -3);
+#endif
+        std::cout << "unwrap pointer: ok\n";
+    }
+
+    // ===== callback -> std::function -> callback: the original comes back =====
+    {
+        callback_t original = Offset{ 5, {} };
+        Offset* target = original.target<Offset>();
+
+        function_t func = std::move(original).to_function();    // wrapped once
+        long long before = allocations.load();
+        callback_t back = std::move(func);                       // moved out, no allocation
+        CHECK(allocations.load() == before);
+        CHECK(back.target<Offset>() == target);
+        CHECK(back(1) == 6);
+
+        function_t copy = back.to_function();
+        before = allocations.load();
+        callback_t again = copy;                                 // a copy costs the same as copying a callback
+        CHECK(allocations.load() == before + 1);
+        CHECK(again.target<Offset>() != nullptr && again(2) == 7);
+        std::cout << "round trip callback: ok\n";
+    }
+
+    // ===== std::function -> callback -> std::function: moved, never wrapped twice =====
+    {
+        function_t original = Offset{ 7, {} };
+        const Offset* target = original.target<Offset>();
+
+        callback_t cb = std::move(original);                     // one box for the std::function itself
+        CHECK(cb.target<function_t>() != nullptr);
+        long long before = allocations.load();
+        function_t back = std::move(cb).to_function();
+        CHECK(allocations.load() == before);
+        CHECK(!cb);
+        CHECK(back.target<Offset>() == target);
+        CHECK(back(1) == 8);
+
+        callback_t pointer = &twice;
+        before = allocations.load();
+        function_t from_pointer = pointer.to_function();
+        CHECK(allocations.load() == before);
+        CHECK(*from_pointer.target<int(*)(int)>() == &twice);
+        CHECK(!callback_t().to_function());
+        std::cout << "round trip std::function: ok\n";
+    }
+
+    // ===== move-only targets are moved in, a copy is empty =====
+    {
+        callback_t cb = Unique{ std::unique_ptr<int>(new int(3)) };
+        CHECK(cb(1) == 4);
+        callback_t copy = cb;
+        CHECK(!copy);
+        callback_t moved = std::move(cb);
+        CHECK(moved(2) == 5);
+        std::cout << "move-only target: ok\n";
+    }
+
+#if defined(__cpp_lib_move_only_function)
+    // ===== std::move_only_function -> callback -> std::move_only_function =====
+    {
+        std::move_only_function<int(int)> original = Unique{ std::unique_ptr<int>(new int(4)) };
+        callback_t cb = std::move(original);
+        CHECK(cb(1) == 5);
+        long long before = allocations.load();
+        std::move_only_function<int(int)> back = std::move(cb).to_move_only_function();
+        CHECK(allocations.load() == before);
+        CHECK(!cb && back(1) == 5);
+
+        std::move_only_function<int(int)> pointer = callback_t(&twice).to_move_only_function();
+        CHECK(pointer(3) == 6);
+        std::cout << "round trip move_only_function: ok\n";
+    }
+#endif
+
+    // ===== Benchmark: a chain of API boundaries =====
+    {
+        const int hops = 4, N = 10000000;
+        long long before = allocations.load();
+        callback_t wrapped = Offset{ 1, {} };
+        for (int i = 0; i < hops; ++i) wrapped = wrap(wrap(wrapped));
+        long long wrapped_allocations = allocations.load() - before;
+
+        before = allocations.load();
+        callback_t unwrapped = Offset{ 1, {} };
+        for (int i = 0; i < hops; ++i) unwrapped = callback_t(std::move(unwrapped).to_function());
+        long long unwrapped_allocations = allocations.load() - before;
+        CHECK(unwrapped.target<Offset>() != nullptr);
+        CHECK(wrapped(1) == unwrapped(1));
+
+        double wrapped_ns = per_call(wrapped, N);
+        double unwrapped_ns = per_call(unwrapped, N);
+        std::cout << hops << " round trips, wrapped: " << wrapped_allocations << " allocations, "
+                  << wrapped_ns << " ns/call; unwrapped: " << unwrapped_allocations << " allocations, "
+                  << unwrapped_ns << " ns/call\n";
+
+        callback_t pointer = &twice;
+        for (int i = 0; i < hops; ++i) pointer = callback_t(pointer.to_function());
+        CHECK(pointer.target<int(*)(int)>() == &twice);
+        std::cout << "mixed API chain: ok\n";
+    }
+    return 0;
+}
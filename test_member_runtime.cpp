@@ -0,0 +1,138 @@
+// g++ -std=c++11 -O2 test_member_runtime.cpp -o test_member_runtime
+#include <iostream>
+#include "sy_callback.hpp"
+#include "test_util.hpp"
+
+using callback_t = sy_callback::callback<int(int)>;
+using wide_t = sy_callback::wide_callback<int(int)>;
+
+struct Counter {
+    int base;
+    int add(int x) { return base + x; }
+    int peek(int x) const { return base * x; }
+    int poll(int x) volatile { return base - x; }
+    int both(int x) const volatile { return base + 2 * x; }
+    int lvalue(int x) & { return base + 3 * x; }
+    int rvalue(int x) && { return base + 4 * x; }
+    int quiet(int x) noexcept { return base + 5 * x; }
+};
+
+struct Shape {
+    int scale;
+    explicit Shape(int s) : scale(s) {}
+    virtual ~Shape() {}
+    virtual int area(int x) const { return scale * x; }
+};
+struct Square : Shape {
+    explicit Square(int s) : Shape(s) {}
+    int area(int x) const override { return scale * x * x; }
+};
+
+// the second base sits at a non-zero offset: its member pointers carry a this adjustment
+struct Left {
+    int left = 1;
+    int get_left(int x) { return left + x; }
+};
+struct Right {
+    int right = 100;
+    int get_right(int x) { return right + x; }
+    virtual int twice(int x) { return 2 * (right + x); }
+    virtual ~Right() {}
+};
+struct Both : Left, Right {
+    int twice(int x) override { return 3 * (right + x); }
+};
+
+// calls through every qualifier, then through copies, moves and target<>()
+template<typename CALLBACK>
+static bool qualified(Counter& counter) {
+    CALLBACK add = CALLBACK::make(&counter, &Counter::add);
+    CALLBACK peek = CALLBACK::make(&counter, &Counter::peek);
+    CALLBACK poll = CALLBACK::make(&counter, &Counter::poll);
+    CALLBACK both = CALLBACK::make(&counter, &Counter::both);
+    CALLBACK lvalue = CALLBACK::make(&counter, &Counter::lvalue);
+    CALLBACK rvalue = CALLBACK::make(&counter, &Counter::rvalue);
+    CALLBACK quiet = CALLBACK::make(&counter, &Counter::quiet);
+    const Counter* constant = &counter;
+    CALLBACK through_const = CALLBACK::make(constant, &Counter::peek);
+    if (add(1) != 11 || peek(2) != 20 || poll(3) != 7 || both(4) != 18) return false;
+    if (lvalue(1) != 13 || rvalue(1) != 14 || quiet(1) != 15 || through_const(3) != 30) return false;
+
+    CALLBACK copy = add;
+    CALLBACK moved = std::move(copy);
+    counter.base = 20;
+    if (moved(1) != 21 || copy.isCallable() || !(moved == add) || moved == peek) return false;
+    copy = peek;
+    if (copy(2) != 40 || !(copy == peek) || copy.hash() != peek.hash()) return false;
+    if (add.template target<Counter>().operator->() != &counter || add.template target<Counter>()(5) != 25) return false;
+    counter.base = 10;
+    return true;
+}
+
+template<typename CALLBACK>
+static bool inheritance() {
+    Square square(3);
+    Shape& shape = square;
+    CALLBACK area = CALLBACK::make(&shape, &Shape::area);
+    if (area(2) != 12) return false;
+
+    Both object;
+    CALLBACK left = CALLBACK::make(&object, &Both::get_left);
+    CALLBACK right = CALLBACK::make(&object, &Both::get_right);
+    CALLBACK twice = CALLBACK::make(&object, &Both::twice);
+    Right* as_right = &object;
+    CALLBACK base_twice = CALLBACK::make(as_right, &Right::twice);
+    if (left(1) != 2 || right(1) != 101 || twice(1) != 303 || base_twice(1) != 303) return false;
+    if (left == right || !(twice == CALLBACK::make(&object, &Both::twice))) return false;
+
+    CALLBACK copy = right;
+    return copy(2) == 102 && copy == right;
+}
+
+int main() {
+    // ===== Size =====
+    {
+        CHECK(sizeof(callback_t) == 2 * sizeof(void*));
+        CHECK(sizeof(sy_callback::callback<void()>) == 2 * sizeof(void*));
+        CHECK(sizeof(wide_t) == (2 + sy_callback::member_pointer_words) * sizeof(void*));
+        std::cout << "size: " << sizeof(callback_t) << " / " << sizeof(wide_t) << " bytes: ok\n";
+    }
+
+    // ===== Qualified member pointers, heap record and inline =====
+    {
+        Counter counter = { 10 };
+        CHECK(qualified<callback_t>(counter));
+        CHECK(qualified<wide_t>(counter));
+        std::cout << "qualifiers: ok\n";
+    }
+
+    // ===== Virtual and multiple inheritance =====
+    {
+        CHECK(inheritance<callback_t>());
+        CHECK(inheritance<wide_t>());
+        std::cout << "inheritance: ok\n";
+    }
+
+    // ===== Allocations =====
+    {
+        Counter counter = { 1 };
+        long long before = allocations;
+        {
+            wide_t wide = wide_t::make(&counter, &Counter::add);
+            wide_t copy = wide;
+            CHECK(copy(1) == 2);
+        }
+        CHECK(allocations == before);
+
+        // the record is owned: one per binding and one per copy, moves only move the pointer
+        {
+            callback_t narrow = callback_t::make(&counter, &Counter::add);
+            callback_t copy = narrow;
+            callback_t moved = std::move(narrow);
+            CHECK(moved(1) == 2 && copy(2) == 3);
+        }
+        CHECK(allocations == before + 2);
+        std::cout << "allocations: ok\n";
+    }
+    return 0;
+}
@@ -0,0 +1,89 @@
+// g++ -std=c++11 -O2 test_member_value.cpp -o test_member_value
+#include <iostream>
+#include <memory>
+#include <string>
+#include "sy_callback.hpp"
+#include "test_util.hpp"
+
+using callback_t = sy_callback::callback<int(int)>;
+
+// trivially copyable and one word: stored inline
+struct Scale {
+    int factor;
+    int apply(int x) const { return factor * x; }
+    int bump(int x) { return factor += x; }
+};
+
+// owns a string: stored on the heap, counts its live instances
+static int alive = 0;
+struct Prefix {
+    std::string text;
+    explicit Prefix(std::string t) : text(std::move(t)) { ++alive; }
+    Prefix(const Prefix& other) : text(other.text) { ++alive; }
+    Prefix(Prefix&& other) : text(std::move(other.text)) { ++alive; }
+    ~Prefix() { --alive; }
+    int length(int x) const { return static_cast<int>(text.size()) + x; }
+};
+
+// move-only: the binding moves, a copy of the callback is empty
+struct Owner {
+    std::unique_ptr<int> value;
+    int add(int x) { return *value + x; }
+};
+
+int main() {
+    // ===== By value, inline and on the heap =====
+    {
+        callback_t inline_cb = callback_t::make<Scale, &Scale::apply>(Scale{ 3 });
+        callback_t copy = inline_cb;
+        CHECK(inline_cb(2) == 6 && copy(3) == 9);
+        copy.target<Scale>()->factor = 4;
+        CHECK(inline_cb(1) == 3 && copy(1) == 4);
+
+        callback_t counter = callback_t::make<Scale, &Scale::bump>(Scale{ 0 });
+        counter(5);
+        CHECK(counter(1) == 6);
+
+        {
+            callback_t heap = callback_t::make<Prefix, &Prefix::length>(Prefix("abc"));
+            CHECK(alive == 1 && heap(1) == 4);
+            callback_t heap_copy = heap;
+            CHECK(alive == 2 && heap_copy(0) == 3);
+            heap_copy.target<Prefix>()->text = "abcdef";
+            CHECK(heap(0) == 3 && heap_copy(0) == 6);
+            callback_t moved = std::move(heap);
+            CHECK(alive == 2 && !heap && moved(0) == 3);
+        }
+        CHECK(alive == 0);
+        std::cout << "by value: ok\n";
+    }
+
+    // ===== Move-only objects =====
+    {
+        callback_t owner = callback_t::make<Owner, &Owner::add>(Owner{ std::unique_ptr<int>(new int(40)) });
+        CHECK(owner(2) == 42);
+        callback_t moved = std::move(owner);
+        CHECK(!owner && moved(1) == 41);
+        callback_t copy = moved;            // cannot be copied: an empty callback
+        CHECK(!copy && moved(0) == 40);
+        copy = moved;
+        CHECK(!copy && moved.isCallable());
+        std::cout << "move-only: ok\n";
+    }
+
+    // ===== Const objects =====
+    {
+        callback_t scale = callback_t::make<const Scale, &Scale::apply>(Scale{ 5 });
+        callback_t prefix = callback_t::make<const Prefix, &Prefix::length>(Prefix("xy"));
+        callback_t scale_copy = scale, prefix_copy = prefix;
+        CHECK(scale(2) == 10 && scale_copy(1) == 5);
+        CHECK(prefix(1) == 3 && prefix_copy(0) == 2 && alive == 2);
+        CHECK(scale.target<const Scale>()->factor == 5 && !scale.target<Scale>());
+        CHECK(prefix.target<const Prefix>()->text == "xy" && !prefix.target<Prefix>());
+        prefix.reset();
+        prefix_copy.reset();
+        CHECK(alive == 0);
+        std::cout << "const: ok\n";
+    }
+    return 0;
+}
@@ -0,0 +1,110 @@
+// g++ -std=c++11 -O2 -pthread test_memoize.cpp -o test_memoize
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+#include "sy_memoize.hpp"
+#include "test_util.hpp"
+
+static std::atomic<long long> computed(0);
+
+// a pure function of (symbol, tier) that takes a while
+static double fair_value(int symbol, int tier) {
+    computed.fetch_add(1, std::memory_order_relaxed);
+    double value = symbol;
+    for (int i = 0; i < 2000; ++i) value = std::sqrt(value * value + tier + i);
+    return value;
+}
+
+using pricing_t = sy_callback::callback<double(int, int)>;
+
+int main() {
+    // ===== Hits, misses, no allocation after construction =====
+    {
+        sy_callback::memoized<double(int, int)> cached(pricing_t::make<&fair_value>(), 256);
+        CHECK(cached.capacity() == 256);
+        long long before = allocations.load();
+        computed = 0;
+        for (int round = 0; round < 10; ++round)
+            for (int symbol = 0; symbol < 50; ++symbol)
+                CHECK(cached(symbol, symbol % 3) == fair_value(symbol, symbol % 3));
+        CHECK(allocations.load() == before);
+        sy_callback::memo_statistics s = cached.stats();
+        CHECK(s.misses == 50 && s.hits == 450 && s.evictions == 0);
+        CHECK(computed == 50 + 500);        // the check above calls fair_value too
+        std::cout << "hits and misses: ok, hit rate " << cached.hit_rate() << "\n";
+    }
+
+    // ===== Bounded: more keys than slots =====
+    {
+        sy_callback::memoized<double(int, int)> cached(pricing_t::make<&fair_value>(), 64);
+        for (int symbol = 0; symbol < 1000; ++symbol) cached(symbol, 0);
+        CHECK(cached.size() <= cached.capacity());
+        CHECK(cached.stats().evictions > 0);
+        // a hot key survives a stream of cold ones
+        cached.reset_stats();
+        for (int i = 0; i < 1000; ++i) {
+            cached(-1, 1);
+            cached(100000 + i, 0);
+        }
+        CHECK(cached.stats().hits >= 990);
+        cached.clear();
+        CHECK(cached.size() == 0);
+        std::cout << "eviction: ok\n";
+    }
+
+    // ===== Thread-owned shards, more threads than shards =====
+    {
+        sy_callback::sharded_memoized<double(int, int)> cached(pricing_t::make<&fair_value>(), 256, 4);
+        CHECK(cached.shards() == 4);
+        std::atomic<bool> wrong(false);
+        auto run = [&](int threads_count) {
+            std::vector<std::thread> threads;
+            for (int t = 0; t < threads_count; ++t) {
+                threads.emplace_back([&]() {
+                    for (int round = 0; round < 100; ++round)
+                        for (int symbol = 0; symbol < 32; ++symbol)
+                            if (cached(symbol, 1) != fair_value(symbol, 1)) wrong = true;
+                });
+            }
+            for (std::thread& t : threads) t.join();
+        };
+        run(8);                             // ids beyond 4 share the locked table
+        CHECK(!wrong);
+        sy_callback::memo_statistics s = cached.stats();
+        CHECK(s.hits + s.misses == 8 * 100 * 32);
+        CHECK(s.misses <= 5 * 32);          // four owned tables and the shared one
+
+        cached.reset_stats();
+        s = cached.stats();
+        CHECK(s.hits == 0 && s.misses == 0 && s.evictions == 0);
+
+        // cleared tables miss again, the counters keep running from the reset
+        cached.clear();
+        for (int symbol = 0; symbol < 32; ++symbol) CHECK(cached(symbol, 1) == fair_value(symbol, 1));
+        s = cached.stats();
+        CHECK(s.misses == 32 && s.hits == 0);
+        run(4);
+        CHECK(!wrong);
+        std::cout << "sharded: ok, hit rate " << cached.hit_rate() << "\n";
+    }
+
+    // ===== Cost =====
+    {
+        const int N = 200000;
+        sy_callback::memoized<double(int, int)> cached(pricing_t::make<&fair_value>(), 1024);
+        pricing_t direct = pricing_t::make<&fair_value>();
+        double sum = 0;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < N; ++i) sum += direct(i % 500, 1);
+        auto mid = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < N; ++i) sum += cached(i % 500, 1);
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "direct: " << std::chrono::duration<double, std::nano>(mid - start).count() / N << " ns/call, "
+                  << "memoized: " << std::chrono::duration<double, std::nano>(end - mid).count() / N << " ns/call"
+                  << " (" << static_cast<long long>(sum) % 7 << ")\n";
+    }
+    return 0;
+}
@@ -0,0 +1,92 @@
+// g++ -std=c++11 -O2 test_multi_callback.cpp -o test_multi_callback
+#include <iostream>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <string>
+#include "sy_callback.hpp"
+#include "test_util.hpp"
+
+struct Login  { std::string user; };
+struct Logout { int session; };
+
+// counts its live instances
+static int alive = 0;
+struct Handler {
+    int logins = 0, logouts = 0;
+    Handler() { ++alive; }
+    Handler(const Handler& other) : logins(other.logins), logouts(other.logouts) { ++alive; }
+    ~Handler() { --alive; }
+    std::size_t operator()(const Login& m) { ++logins; return m.user.size(); }
+    std::size_t operator()(const Logout& m) { ++logouts; return static_cast<std::size_t>(m.session); }
+    std::size_t operator()(int x) const { return static_cast<std::size_t>(x) * 2; }
+};
+
+using multi_t = sy_callback::multi_callback<std::size_t(const Login&), std::size_t(const Logout&), std::size_t(int)>;
+
+struct MoveOnly {
+    std::unique_ptr<int> value;
+    int operator()(int x) const { return *value + x; }
+    int operator()(double x) const { return *value + static_cast<int>(x * 10); }
+};
+
+int main() {
+    // ===== Overloads reach one stored object =====
+    {
+        long long before = allocations;
+        multi_t cb = Handler();
+        CHECK(allocations == before + 1 && alive == 1);
+        CHECK(cb(Login{ "yune" }) == 4);
+        CHECK(cb(Logout{ 42 }) == 42);
+        CHECK(cb(21) == 42);
+        Handler* handler = cb.target<Handler>();
+        CHECK(handler && handler->logins == 1 && handler->logouts == 1);
+        std::cout << "dispatch: ok\n";
+    }
+    CHECK(alive == 0);
+
+    // ===== Copy, move, swap and reset =====
+    {
+        multi_t cb = Handler();
+        cb(Login{ "a" });
+        multi_t copy = cb;
+        CHECK(alive == 2 && copy.target<Handler>() != cb.target<Handler>());
+        copy(Login{ "b" });
+        CHECK(cb.target<Handler>()->logins == 1 && copy.target<Handler>()->logins == 2);
+
+        multi_t moved = std::move(copy);
+        CHECK(!copy && moved && alive == 2 && moved.target<Handler>()->logins == 2);
+        moved.swap(copy);
+        CHECK(copy && !moved);
+        moved = cb;
+        CHECK(alive == 3 && moved(Logout{ 7 }) == 7);
+        moved = std::move(copy);
+        CHECK(alive == 2 && !copy && moved.target<Handler>()->logins == 2);
+        moved.reset();
+        CHECK(!moved && !moved.isCallable() && alive == 1);
+        std::cout << "copy / move: ok\n";
+    }
+    CHECK(alive == 0);
+
+    // ===== Empty, move-only =====
+    {
+        multi_t empty;
+        CHECK(!empty);
+        bool thrown = false;
+        try { empty(1); }
+        catch (const std::bad_function_call&) { thrown = true; }
+        CHECK(thrown);
+        thrown = false;
+        try { empty(Logout{ 1 }); }
+        catch (const std::bad_function_call&) { thrown = true; }
+        CHECK(thrown);
+
+        sy_callback::multi_callback<int(int), int(double)> owner = MoveOnly{ std::unique_ptr<int>(new int(5)) };
+        CHECK(owner(1) == 6 && owner(0.5) == 10);
+        sy_callback::multi_callback<int(int), int(double)> copy = owner;     // cannot be copied: empty
+        CHECK(!copy && owner(0) == 5);
+        std::cout << "empty / move-only: ok\n";
+    }
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "sy_parallel_emit.hpp"
+#include "test_util.hpp"
+
+// a per-account check, heavy enough that one emission is worth splitting
+struct account {
+    double limit;
+    long long check(double price) const {
+        double value = price;
+        for (int i = 0; i < 64; ++i) value = std::sqrt(value * limit + 1.0);
+        return static_cast<long long>(value);
+    }
+};
+
+// a reduction value owning heap memory
+struct labelled {
+    std::string label;
+    long long sum;
+    labelled(long long value) : label("partial sum of a parallel reduction"), sum(value) {}
+};
+
+template<typename FUNC>
+static double measure(int rounds, FUNC func) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) func();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    const std::size_t count = 8192;
+    std::vector<account> accounts;
+    for (std::size_t i = 0; i < count; ++i) accounts.push_back(account{ 1.0 + static_cast<double>(i % 97) });
+
+    sy_callback::signal<long long(double)> checks;
+    for (const account& a : accounts) checks.connect(sy_callback::callback<long long(double)>::make<account, &account::check>(&a));
+
+    long long expected = 0;
+    for (const account& a : accounts) expected += a.check(3.0);
+
+    // ===== Correctness =====
+    {
+        sy_callback::emit_pool pool(4);
+        long long sum = pool.emit_reduce(checks, 0ll, [](long long a, long long b) { return a + b; }, 3.0);
+        if (sum != expected) { std::cout << "parallel reduce: failed\n"; return 1; }
+
+        // the partials stay in the pool: a second reduction allocates nothing
+        long long before = allocations.load();
+        sum = pool.emit_reduce(checks, 0ll, [](long long a, long long b) { return a + b; }, 3.0);
+        if (sum != expected || allocations.load() != before) { std::cout << "reused partials: failed\n"; return 1; }
+
+        // a partial type with its own storage is constructed and destroyed every time
+        labelled total = pool.emit_reduce(checks, labelled(0),
+            [](const labelled& a, const labelled& b) { return labelled(a.sum + b.sum); }, 3.0);
+        if (total.sum != expected) { std::cout << "non-trivial reduce: failed\n"; return 1; }
+
+        std::vector<int> hits(count, 0);
+        sy_callback::signal<void(int)> marks;
+        for (std::size_t i = 0; i < count; ++i) marks.connect([&hits, i](int value) { hits[i] += value; });
+        pool.emit(marks, 1);
+        for (int h : hits) if (h != 1) { std::cout << "parallel emit: failed\n"; return 1; }
+
+        sy_callback::signal<void()> throwing;
+        for (std::size_t i = 0; i < count; ++i) throwing.connect([i]() { if (i == count - 1) throw std::runtime_error("slot"); });
+        bool caught = false;
+        try { pool.emit(throwing); }
+        catch (const std::runtime_error&) { caught = true; }
+        if (!caught) { std::cout << "parallel exception: failed\n"; return 1; }
+
+        // below the threshold the caller emits alone
+        sy_callback::signal<long long(double)> few;
+        few.connect(sy_callback::callback<long long(double)>::make<account, &account::check>(&accounts[0]));
+        if (pool.emit_reduce(few, 0ll, [](long long a, long long b) { return a + b; }, 3.0) != accounts[0].check(3.0)) {
+            std::cout << "serial fallback: failed\n";
+            return 1;
+        }
+        std::cout << "parallel emit: ok\n";
+    }
+
+    // ===== Scaling from 1 to 64 threads =====
+    const int rounds = 50;
+    double ms = measure(rounds, [&]() {
+        long long sum = 0;
+        for (const auto& slot : checks) sum += slot(3.0);
+        if (sum != expected) std::abort();
+    });
+    std::cout << "serial emission: " << ms << " ms\n";
+
+    for (std::size_t threads : { 1, 2, 4, 8, 16, 32, 64 }) {
+        sy_callback::emit_pool pool(threads);
+        ms = measure(rounds, [&]() {
+            if (pool.emit_reduce(checks, 0ll, [](long long a, long long b) { return a + b; }, 3.0) != expected) std::abort();
+        });
+        std::cout << "emit_pool " << threads << " thread(s): " << ms << " ms\n";
+    }
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency() << "\n";
+    return 0;
+}
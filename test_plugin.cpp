@@ -0,0 +1,106 @@
+// g++ -std=c++11 -O2 -shared -fPIC test_plugin_library.cpp -o libsy_test_plugin.so
+// g++ -std=c++11 -O2 -pthread test_plugin.cpp -o test_plugin -ldl && ./test_plugin ./libsy_test_plugin.so
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "sy_plugin.hpp"
+#include "test_util.hpp"
+
+using entry_t = sy_callback::callback<int(int, int)>;
+
+int main(int argc, char** argv) {
+    const std::string path = argc > 1 ? argv[1] : "./libsy_test_plugin.so";
+
+    // ===== Lazy binding =====
+    {
+        sy_callback::plugin_registry registry;
+        entry_t add = registry.declare<int(int, int)>(path, "plugin_add");
+        entry_t scale = registry.declare<int(int, int)>(path, "plugin_scale");
+        entry_t missing = registry.declare<int(int, int)>(path, "plugin_missing");
+        entry_t absent = registry.declare<int(int, int)>("./libsy_no_such_plugin.so", "plugin_add");
+        CHECK(registry.declared() == 4);
+        CHECK(registry.loaded_libraries() == 0);
+        CHECK(add.isCallable() && !add.target<int(*)(int, int)>());
+
+        entry_t copy = add;
+        CHECK(add(2, 3) == 5);
+        CHECK(registry.loaded_libraries() == 1);
+
+        // the callback is not rewritten: copies made before the first call use the cached address
+        CHECK(!add.target<int(*)(int, int)>() && add == copy);
+        CHECK(copy(4, 5) == 9);
+        CHECK(scale(4, 5) == 20);
+        CHECK(registry.loaded_libraries() == 1);
+
+        bool thrown = false;
+        try { missing(1, 2); }
+        catch (const sy_callback::plugin_error&) { thrown = true; }
+        CHECK(thrown);
+
+        thrown = false;
+        try { absent(1, 2); }
+        catch (const sy_callback::plugin_error&) { thrown = true; }
+        CHECK(thrown);
+        std::cout << "lazy plugin binding: ok\n";
+    }
+
+    // ===== First calls from several threads at once =====
+    {
+        sy_callback::plugin_registry registry;
+        const entry_t shared = registry.declare<int(int, int)>(path, "plugin_add");
+        std::vector<entry_t> entries;
+        for (int i = 0; i < 64; ++i) entries.push_back(registry.declare<int(int, int)>(path, i % 2 ? "plugin_add" : "plugin_scale"));
+
+        std::atomic<bool> start(false);
+        std::atomic<int> wrong(0);
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; ++t) {
+            threads.emplace_back([&, t]() {
+                while (!start.load(std::memory_order_acquire)) std::this_thread::yield();
+                for (int i = 0; i < 1000; ++i) if (shared(i, t) != i + t) ++wrong;
+                for (std::size_t i = 0; i < entries.size(); ++i) {
+                    int expected = i % 2 ? t + 3 : t * 3;
+                    if (entries[i](t, 3) != expected) ++wrong;
+                }
+            });
+        }
+        start.store(true, std::memory_order_release);
+        for (std::thread& thread : threads) thread.join();
+        CHECK(wrong == 0 && registry.loaded_libraries() == 1);
+        std::cout << "concurrent first calls: ok\n";
+    }
+
+    // ===== Cost of declaring vs eager resolution, and of later calls =====
+    const int entries = 400;
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        sy_callback::plugin_registry registry;
+        std::vector<entry_t> table;
+        for (int i = 0; i < entries; ++i) table.push_back(registry.declare<int(int, int)>(path, "plugin_calls"));
+        auto end = std::chrono::high_resolution_clock::now();
+        std::cout << "declare " << entries << " entry points: " << std::chrono::duration<double, std::micro>(end - start).count() << " us\n";
+
+        start = std::chrono::high_resolution_clock::now();
+        registry.resolve_all();
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "resolve them all: " << std::chrono::duration<double, std::micro>(end - start).count() << " us\n";
+
+        const int N = 10000000;
+        entry_t lazy = registry.declare<int(int, int)>(path, "plugin_add");
+        entry_t direct = reinterpret_cast<int(*)(int, int)>(::dlsym(::dlopen(path.c_str(), RTLD_LAZY | RTLD_NOLOAD), "plugin_add"));
+        lazy(0, 0);
+        long long sum = 0;
+        start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < N; ++i) sum += lazy(i, 1);
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "lazy callback after first call: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+        start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < N; ++i) sum += direct(i, 1);
+        end = std::chrono::high_resolution_clock::now();
+        std::cout << "function pointer callback: " << std::chrono::duration<double, std::milli>(end - start).count() << " ms\n";
+        if (sum == 42) std::cout << "";
+    }
+    return 0;
+}
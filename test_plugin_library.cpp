@@ -0,0 +1,6 @@
+// plugin loaded by test_plugin.cpp
+extern "C" int plugin_add(int a, int b) { return a + b; }
+extern "C" int plugin_scale(int a, int b) { return a * b; }
+
+static int calls = 0;
+extern "C" int plugin_calls(int, int) { return ++calls; }
@@ -0,0 +1,92 @@
+// g++ -std=c++11 -O2 -pthread -DSY_CALLBACK_POOL test_pool.cpp -o test_pool
+#include <iostream>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "sy_callback.hpp"
+#include "test_util.hpp"
+
+// 40 bytes of captures: too big for the inline storage, the callback stores it on the heap
+struct handler {
+    long long a, b, c, d, e;
+    long long operator()(long long x) const { return a + b + c + d + e + x; }
+};
+using callback_t = sy_callback::callback<long long(long long)>;
+
+template<typename FUNC>
+static double run_threads(int threads, FUNC func) {
+    std::vector<std::thread> workers;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int t = 0; t < threads; ++t) workers.emplace_back(func, t);
+    for (auto& worker : workers) worker.join();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    const int N = 1000000;
+
+    // ===== Allocation counts =====
+    {
+        long long before = allocations.load();
+        long long sum = 0;
+        for (int i = 0; i < N; ++i) {
+            callback_t cb = handler{ i, 1, 2, 3, 4 };       // constructor
+            callback_t copy = cb;                           // copy path
+            cb = handler{ 0, 0, 0, 0, i };                  // operator=
+            sum += cb(0) + copy(0);
+        }
+        long long used = allocations.load() - before;
+        std::cout << "3 heap targets x " << N << " callbacks: " << used << " global allocations\n";
+#ifdef SY_CALLBACK_POOL
+        sy_callback::pool::statistics s = sy_callback::pool::stats();
+        std::cout << "pool: " << s.allocations << " blocks handed out, " << s.chunks << " chunks\n";
+        if (used > 16) { std::cout << "pool allocation count: failed\n"; return 1; }
+#endif
+        if (sum == 42) std::cout << "";
+    }
+
+    // ===== Cross-thread frees go back to the owner =====
+    {
+        const int count = 100000;
+        std::vector<callback_t> made(count);
+        std::thread producer([&]() { for (int i = 0; i < count; ++i) made[i] = handler{ i, 0, 0, 0, 0 }; });
+        producer.join();
+        long long sum = 0;
+        for (const callback_t& cb : made) sum += cb(0);
+        made.clear();
+        if (sum != (long long)count * (count - 1) / 2) { std::cout << "cross-thread frees: failed\n"; return 1; }
+#ifdef SY_CALLBACK_POOL
+        std::cout << "cross-thread frees: " << sy_callback::pool::stats().remote_frees << " remote frees\n";
+#endif
+    }
+
+    // ===== Multi-threaded create / destroy =====
+    for (int threads : { 1, 2, 4, 8, 16, 32 }) {
+        const int per_thread = N / threads;
+        double ms = run_threads(threads, [&](int t) {
+            long long sum = 0;
+            std::vector<callback_t> batch(64);
+            for (int i = 0; i < per_thread; i += 64) {
+                for (int k = 0; k < 64; ++k) batch[k] = handler{ t, i, k, 0, 0 };
+                for (int k = 0; k < 64; ++k) sum += batch[k](0);
+                for (int k = 0; k < 64; ++k) batch[k].reset();
+            }
+            if (sum == 42) std::cout << "";
+        });
+        std::cout << "callback create/destroy, " << threads << " thread(s): " << ms << " ms\n";
+
+        ms = run_threads(threads, [&](int t) {
+            long long sum = 0;
+            std::vector<handler*> batch(64);
+            for (int i = 0; i < per_thread; i += 64) {
+                for (int k = 0; k < 64; ++k) batch[k] = new handler{ t, i, k, 0, 0 };
+                for (int k = 0; k < 64; ++k) sum += (*batch[k])(0);
+                for (int k = 0; k < 64; ++k) delete batch[k];
+            }
+            if (sum == 42) std::cout << "";
+        });
+        std::cout << "global new/delete, " << threads << " thread(s): " << ms << " ms\n";
+    }
+    return 0;
+}
@@ -0,0 +1,154 @@
+// g++ -std=c++11 -O2 test_remote.cpp -o test_remote        (Linux: memfd_create)
+#include <iostream>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <new>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "sy_remote.hpp"
+#include "test_util.hpp"
+
+struct Order {
+    std::uint32_t id;
+    double price;
+    std::int32_t quantity;
+};
+
+// the IDs both processes agree on, the sender never sees a callback
+namespace ids {
+    const sy_callback::remote_id<void(int, int)> add = { 0 };
+    const sy_callback::remote_id<void(double)> scale = { 1 };
+    const sy_callback::remote_id<void(const Order&)> order = { 2 };
+    const sy_callback::remote_id<void()> stop = { 7 };
+}
+
+// single producer, single consumer ring of records in a shared mapping
+struct ring {
+    static constexpr std::uint32_t slots = 256;
+    std::atomic<std::uint32_t> head;    // next record to read, written by the receiver
+    std::atomic<std::uint32_t> tail;    // next record to write, written by the sender
+    sy_callback::invocation<> records[slots];
+
+    void push(const sy_callback::invocation<>& record) {
+        std::uint32_t t = tail.load(std::memory_order_relaxed);
+        while (t - head.load(std::memory_order_acquire) == slots) {}
+        records[t % slots] = record;
+        tail.store(t + 1, std::memory_order_release);
+    }
+    bool pop(sy_callback::invocation<>& record) {
+        std::uint32_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return false;
+        record = records[h % slots];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+const int N = 100000;
+
+struct Book {
+    long long orders = 0;
+    double notional = 0;
+    void on_order(const Order& o) { ++orders; notional += o.price * o.quantity; }
+};
+
+// runs in its own process (exec'd, so nothing of the receiver's address space is shared)
+static int sender(int fd) {
+    void* memory = ::mmap(nullptr, sizeof(ring), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (memory == MAP_FAILED) return 2;
+    ring* r = static_cast<ring*>(memory);
+    for (int i = 0; i < N; ++i) {
+        r->push(sy_callback::encode(ids::add, i, 1));
+        if (i % 10 == 0) r->push(sy_callback::encode(ids::scale, 0.5));
+        if (i % 100 == 0) r->push(sy_callback::encode(ids::order, Order{ static_cast<std::uint32_t>(i), 2.5, 4 }));
+    }
+    r->push(sy_callback::encode(ids::stop));
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc == 3 && std::string(argv[1]) == "--sender") return sender(std::atoi(argv[2]));
+
+    long long sum = 0;
+    double scaled = 0;
+    bool stopped = false;
+    Book book;
+
+    sy_callback::remote_registry<> registry;
+    registry.add<void(int, int)>([&sum](int a, int b) { sum += a + b; });
+    registry.add<void(double)>([&scaled](double x) { scaled += x; });
+    registry.add(sy_callback::callback<void(const Order&)>::make<Book, &Book::on_order>(&book));
+    registry.add<void()>(ids::stop.value, [&stopped]() { stopped = true; });
+    CHECK(registry.capacity() == 8);
+    CHECK(registry.contains(7) && !registry.contains(5) && !registry.contains(100));
+
+    // ===== In process: encode, dispatch, rejected records =====
+    {
+        CHECK(registry.dispatch(sy_callback::encode(ids::add, 2, 3)));
+        CHECK(sum == 5);
+        CHECK(registry.dispatch(sy_callback::encode(ids::order, Order{ 1, 10.0, 2 })));
+        CHECK(book.orders == 1 && book.notional == 20.0);
+
+        sy_callback::remote_id<void(int)> wrong = { ids::scale.value };   // 4 bytes for a handler of 8
+        CHECK(!registry.dispatch(sy_callback::encode(wrong, 1)));
+        CHECK(!registry.dispatch(sy_callback::encode(sy_callback::remote_id<void()>{ 5 })));
+        CHECK(!registry.dispatch(sy_callback::encode(sy_callback::remote_id<void()>{ 1000 })));
+        CHECK(scaled == 0);
+
+        sy_callback::remote_id<void(int)> temporary = registry.add<void(int)>(5, [&sum](int x) { sum += x; });
+        CHECK(registry.dispatch(sy_callback::encode(temporary, 10)));
+        CHECK(sum == 15);
+        CHECK(registry.remove(5) && !registry.remove(5));
+        CHECK(!registry.dispatch(sy_callback::encode(temporary, 10)));
+
+        CHECK(sizeof(sy_callback::invocation<>) == 64);
+        CHECK(std::is_trivially_copyable<sy_callback::invocation<>>::value);
+        sum = 0;
+        book = Book();
+        std::cout << "dispatch: ok\n";
+    }
+
+    // ===== Two processes over a memfd ring =====
+    {
+        int fd = ::memfd_create("sy_remote_test", 0);
+        CHECK(fd >= 0);
+        CHECK(::ftruncate(fd, sizeof(ring)) == 0);
+        void* memory = ::mmap(nullptr, sizeof(ring), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        CHECK(memory != MAP_FAILED);
+        ring* r = new (memory) ring();
+        r->head.store(0);
+        r->tail.store(0);
+
+        pid_t child = ::fork();
+        CHECK(child >= 0);
+        if (child == 0) {
+            std::string descriptor = std::to_string(fd);
+            ::execl("/proc/self/exe", argv[0], "--sender", descriptor.c_str(), static_cast<char*>(nullptr));
+            std::_Exit(3);
+        }
+
+        long long received = 0, rejected = 0;
+        sy_callback::invocation<> record;
+        while (!stopped) {
+            if (!r->pop(record)) continue;
+            ++received;
+            if (!registry.dispatch(record)) ++rejected;
+        }
+        int status = 0;
+        CHECK(::waitpid(child, &status, 0) == child);
+        CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+        CHECK(rejected == 0);
+        CHECK(received == N + N / 10 + N / 100 + 1);
+        CHECK(sum == static_cast<long long>(N) * (N - 1) / 2 + N);
+        CHECK(scaled == 0.5 * (N / 10));
+        CHECK(book.orders == N / 100 && book.notional == 10.0 * (N / 100));
+        ::munmap(memory, sizeof(ring));
+        ::close(fd);
+        std::cout << "two processes: ok, " << received << " records\n";
+    }
+    return 0;
+}
@@ -0,0 +1,188 @@
+// g++ -std=c++11 -O2 -pthread test_sharded.cpp -o test_sharded
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "sy_sharded.hpp"
+#include "test_util.hpp"
+
+using registry_t = sy_callback::sharded_registry<void(int)>;
+using handler_t = registry_t::handler_t;
+
+// per worker result, padded like the shards so only the callback storage is shared in the benchmark
+struct counter {
+    long long value;
+    char padding[64];
+
+    void add_one(int) { ++value; }
+    void add_two(int) { value += 2; }
+};
+
+// move-only: a callback can hold it, a shard cannot copy it
+struct owner {
+    std::unique_ptr<int> value;
+    void operator()(int x) const { *value += x; }
+};
+
+template<typename F>
+static double run_workers(std::size_t workers, F work) {
+    std::vector<std::thread> threads;
+    std::atomic<std::size_t> ready(0);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t t = 0; t < workers; ++t)
+        threads.emplace_back([&, t]() {
+            ready.fetch_add(1);
+            while (ready.load() < workers) std::this_thread::yield();
+            work(t);
+        });
+    for (std::thread& t : threads) t.join();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    // ===== Broadcast: every shard sees add, assign and remove =====
+    {
+        registry_t registry(4);
+        CHECK(registry.shards() == 4);
+        std::atomic<int> total(0);
+        registry_t::slot_t a = registry.add([&total](int x) { total += x; });
+        registry_t::slot_t b = registry.add([&total](int x) { total += 10 * x; });
+        CHECK(a != b && registry.slots() == 2);
+
+        run_workers(4, [&](std::size_t t) { registry.emit(t, 1); });
+        CHECK(total == 44);
+
+        CHECK(registry.assign(b, [&total](int x) { total += 100 * x; }));
+        CHECK(registry.remove(a) && !registry.remove(a) && !registry.assign(a, handler_t()));
+        total = 0;
+        run_workers(4, [&](std::size_t t) { registry.emit(t, 1); });
+        CHECK(total == 400);
+
+        registry_t::slot_t c = registry.add([&total](int x) { total -= x; });
+        CHECK(c == a);                          // the freed slot is reused
+        total = 0;
+        registry.invoke(2, c, 5);
+        registry.invoke(2, b, 1);
+        CHECK(total == 95);
+        std::cout << "broadcast: ok\n";
+    }
+
+    // ===== Slabs are line aligned and private to their shard =====
+    {
+        registry_t registry(3);
+        for (int i = 0; i < 5; ++i) registry.add([](int) {});
+        std::vector<std::uintptr_t> first, last;
+        for (std::size_t t = 0; t < 3; ++t) {
+            std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(&registry.local(t, 0));
+            std::uintptr_t end = reinterpret_cast<std::uintptr_t>(&registry.local(t, 4) + 1);
+            CHECK(begin % 64 == 0);
+            first.push_back(begin);
+            last.push_back((end - 1) / 64);
+        }
+        for (std::size_t i = 0; i < 3; ++i)
+            for (std::size_t j = 0; j < 3; ++j)
+                CHECK(i == j || last[i] < first[j] / 64 || last[j] < first[i] / 64);
+
+        // a local rebind stays on its shard until the next broadcast to the slot
+        counter c = counter();
+        registry.assign(0, handler_t::make<counter, &counter::add_one>(&c));
+        registry.local(1, 0) = handler_t::make<counter, &counter::add_two>(&c);
+        registry.invoke(0, 0, 0);
+        registry.invoke(1, 0, 0);
+        CHECK(c.value == 3);
+        registry.assign(0, handler_t::make<counter, &counter::add_one>(&c));
+        registry.invoke(1, 0, 0);
+        CHECK(c.value == 4);
+        std::cout << "slabs: ok\n";
+    }
+
+    // ===== Every shard needs a copy: move-only targets are refused =====
+    {
+        registry_t registry(2);
+        std::shared_ptr<int> shared(new int(0));
+        CHECK(registry.add([shared](int x) { *shared += x; }) == 0);
+
+        // a callback can hold a move-only target, it would be empty on the shards
+        owner target = { std::unique_ptr<int>(new int(0)) };
+        int* seen = target.value.get();
+        handler_t move_only = std::move(target);
+        CHECK(move_only && registry.add(move_only) == registry_t::invalid_slot);
+        CHECK(!registry.assign(0, move_only) && registry.slots() == 1);
+        move_only(3);
+        CHECK(*seen == 3);
+        // registry.add(owner{ ... });     does not compile: the target must be copyable
+
+        CHECK(registry.assign(0, handler_t()) && registry.slots() == 1);   // an empty handler is fine
+        registry.emit(1, 5);
+        CHECK(*shared == 0);
+        std::cout << "move-only: ok\n";
+    }
+
+    // ===== Threads that exit hand their shard to new ones =====
+    {
+        registry_t registry(4);
+        for (int n = 0; n < 8; ++n) {           // one live thread at a time: always the first shard
+            std::size_t index = registry.shards();
+            std::thread([&]() { index = registry.this_shard(); }).join();
+            CHECK(index == 0);
+        }
+
+        std::vector<std::size_t> indices(registry.shards());
+        std::atomic<std::size_t> ready(0);
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < indices.size(); ++t)
+            threads.emplace_back([&, t]() {
+                indices[t] = registry.this_shard();
+                ready.fetch_add(1);
+                while (ready.load() < indices.size()) std::this_thread::yield();   // all alive at once
+            });
+        for (std::thread& t : threads) t.join();
+        for (std::size_t i = 0; i < indices.size(); ++i)
+            for (std::size_t j = 0; j < i; ++j) CHECK(indices[i] != indices[j]);
+        std::cout << "thread churn: ok\n";
+    }
+
+    // ===== Benchmark: per-core rebinding, shared array against shards =====
+    {
+        std::size_t workers = std::thread::hardware_concurrency();
+        if (workers < 2) workers = 2;
+        if (workers > 8) workers = 8;
+        const int N = 2000000;
+        std::vector<counter> counters(workers);
+        handler_t bound[2][8];
+        for (std::size_t t = 0; t < workers; ++t) {
+            bound[0][t] = handler_t::make<counter, &counter::add_one>(&counters[t]);
+            bound[1][t] = handler_t::make<counter, &counter::add_two>(&counters[t]);
+        }
+
+        // neighbouring workers' callbacks share cache lines
+        std::vector<handler_t> shared(workers);
+        double shared_ms = run_workers(workers, [&](std::size_t t) {
+            for (int i = 0; i < N; ++i) {
+                shared[t] = bound[i & 1][t];
+                shared[t](i);
+            }
+        });
+        for (std::size_t t = 0; t < workers; ++t) CHECK(counters[t].value == 3LL * N / 2);
+
+        registry_t registry(workers);
+        registry_t::slot_t slot = registry.add(handler_t());
+        for (counter& c : counters) c.value = 0;
+        double sharded_ms = run_workers(workers, [&](std::size_t t) {
+            for (int i = 0; i < N; ++i) {
+                handler_t& handler = registry.local(t, slot);
+                handler = bound[i & 1][t];
+                handler(i);
+            }
+        });
+        for (std::size_t t = 0; t < workers; ++t) CHECK(counters[t].value == 3LL * N / 2);
+
+        std::cout << workers << " workers (" << std::thread::hardware_concurrency() << " cores), shared array: "
+                  << shared_ms << " ms, sharded_registry: " << sharded_ms << " ms\n";
+    }
+    return 0;
+}
@@ -0,0 +1,66 @@
+#include <iostream>
+#include "sy_signal.hpp"
+#include "test_util.hpp"
+
+struct Event { int code; };
+
+struct Handler {
+    int accepts;
+    int* calls;
+    bool handle(const Event& e) const { ++*calls; return e.code == accepts; }
+    int weight(const Event& e) const { ++*calls; return e.code * accepts; }
+};
+
+// user-defined: counts the handlers that accepted, stops after the second one
+struct two_accepts {
+    using result_type = int;
+    int count = 0;
+    bool operator()(bool accepted) { count += accepted; return count < 2; }
+    result_type result() const { return count; }
+};
+
+int main() {
+    int calls = 0;
+    Handler handlers[4] = { { 1, &calls }, { 2, &calls }, { 2, &calls }, { 3, &calls } };
+
+    sy_callback::signal<bool(const Event&)> on_event;
+    sy_callback::signal<int(const Event&)> on_weight;
+    for (const Handler& h : handlers) {
+        on_event.connect(sy_callback::callback<bool(const Event&)>::make<Handler, &Handler::handle>(&h));
+        on_weight.connect(sy_callback::callback<int(const Event&)>::make<Handler, &Handler::weight>(&h));
+    }
+
+    long long before = allocations;
+
+    calls = 0;
+    CHECK(on_event.combine(sy_callback::combiners::first_true(), Event{ 2 }) == true);
+    CHECK(calls == 2);
+
+    calls = 0;
+    CHECK(on_event.combine(sy_callback::combiners::first_true(), Event{ 9 }) == false);
+    CHECK(calls == 4);
+
+    calls = 0;
+    CHECK(on_event.combine(sy_callback::combiners::all_of(), Event{ 1 }) == false);
+    CHECK(calls == 2);
+
+    calls = 0;
+    CHECK(on_event.combine(two_accepts(), Event{ 2 }) == 2);
+    CHECK(calls == 3);
+
+    CHECK(on_weight.combine(sy_callback::combiners::sum<int>(), Event{ 2 }) == 16);
+    CHECK(on_weight.combine(sy_callback::combiners::sum<int>(100), Event{ 2 }) == 116);
+    CHECK(on_weight.combine(sy_callback::combiners::max<int>(), Event{ 2 }) == 6);
+    CHECK(on_weight.combine(sy_callback::combiners::last<int>(), Event{ 1 }) == 3);
+
+    CHECK(allocations == before);
+
+    sy_callback::signal<int(const Event&)> nobody;
+    sy_callback::combiners::max<int> none;
+    CHECK(nobody.combine(none, Event{ 1 }) == 0 && none.empty());
+    CHECK(on_weight.combine(none, Event{ 1 }) == 3 && !none.empty());
+    CHECK(sy_callback::signal<bool(const Event&)>().combine(sy_callback::combiners::all_of(), Event{ 1 }) == true);
+
+    std::cout << "signal combiners: ok\n";
+    return 0;
+}
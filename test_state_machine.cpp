@@ -0,0 +1,206 @@
+// g++ -std=c++11 -O2 test_state_machine.cpp -o test_state_machine
+#include <iostream>
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include "sy_state_machine.hpp"
+#include "test_util.hpp"
+
+// synthetic line protocol: "key=123\n", anything else up to the newline is an error
+enum class State { key, value, skip, count };
+enum class Event { letter, digit, equals, newline, other, count };
+
+struct Parser {
+    long long key_chars = 0, digits = 0, keys = 0, values = 0, lines = 0, errors = 0;
+};
+
+static void key_char(Parser& p) { ++p.key_chars; }
+static void digit(Parser& p) { ++p.digits; }
+static void line(Parser& p) { ++p.lines; }
+static void begin_value(Parser& p) { ++p.keys; }
+static void end_value(Parser& p) { ++p.values; }
+static void error(Parser& p) { ++p.errors; }
+
+using machine_t = sy_callback::state_machine<State, Event, Parser>;
+using action_t = machine_t::action_t;
+
+// constant-initialized: no startup code builds it
+static const machine_t::table_t protocol = {
+    // letter                              digit                             equals                     newline                           other
+    { { State::key, action_t(&key_char) }, { State::skip, action_t() },      { State::value, action_t() }, { State::key, action_t() },      { State::skip, action_t() } },
+    { { State::skip, action_t() },         { State::value, action_t(&digit) }, { State::skip, action_t() }, { State::key, action_t(&line) }, { State::skip, action_t() } },
+    { { State::skip, action_t() },         { State::skip, action_t() },      { State::skip, action_t() },  { State::key, action_t() },      { State::skip, action_t() } },
+};
+
+static machine_t make_machine() {
+    machine_t machine(protocol, State::key);
+    machine.on_entry(State::value, &begin_value);
+    machine.on_exit(State::value, &end_value);
+    machine.on_entry(State::skip, &error);
+    return machine;
+}
+
+static Event classify(char c) {
+    if (c >= 'a' && c <= 'z') return Event::letter;
+    if (c >= '0' && c <= '9') return Event::digit;
+    if (c == '=') return Event::equals;
+    if (c == '\n') return Event::newline;
+    return Event::other;
+}
+
+// the hand-written parser being replaced
+struct switch_machine {
+    State state = State::key;
+    void process(Parser& p, Event e) {
+        switch (state) {
+        case State::key:
+            switch (e) {
+            case Event::letter: ++p.key_chars; break;
+            case Event::equals: state = State::value; ++p.keys; break;
+            case Event::newline: break;
+            default: state = State::skip; ++p.errors; break;
+            }
+            break;
+        case State::value:
+            switch (e) {
+            case Event::digit: ++p.digits; break;
+            case Event::newline: ++p.values; ++p.lines; state = State::key; break;
+            default: ++p.values; state = State::skip; ++p.errors; break;
+            }
+            break;
+        default:
+            if (e == Event::newline) state = State::key;
+            break;
+        }
+    }
+};
+
+// a transition lookup in an ordered map, hooks in maps as well
+struct map_machine {
+    std::map<std::pair<State, Event>, std::pair<State, action_t>> table;
+    std::map<State, action_t> entry, exit;
+    State state = State::key;
+
+    map_machine() {
+        for (std::size_t s = 0; s < machine_t::state_count; ++s)
+            for (std::size_t e = 0; e < machine_t::event_count; ++e)
+                table[std::make_pair(State(s), Event(e))] = std::make_pair(protocol[s][e].next, protocol[s][e].action);
+        entry[State::value] = &begin_value;
+        exit[State::value] = &end_value;
+        entry[State::skip] = &error;
+    }
+    void process(Parser& p, Event e) {
+        const std::pair<State, action_t>& t = table.find(std::make_pair(state, e))->second;
+        if (t.first != state) {
+            auto out = exit.find(state);
+            if (out != exit.end()) out->second(p);
+            if (t.second) t.second(p);
+            state = t.first;
+            auto in = entry.find(state);
+            if (in != entry.end()) in->second(p);
+        }
+        else if (t.second) t.second(p);
+    }
+};
+
+static bool same(const Parser& a, const Parser& b) {
+    return a.key_chars == b.key_chars && a.digits == b.digits && a.keys == b.keys &&
+           a.values == b.values && a.lines == b.lines && a.errors == b.errors;
+}
+
+template<typename F>
+static double per_event(F run, std::size_t events, int rounds) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < rounds; ++r) run();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (static_cast<double>(events) * rounds);
+}
+
+int main() {
+    // ===== Transitions, entry and exit order =====
+    {
+        std::string text = "ab=12\nx=\n9\nk=1z\n\nq=7\n";
+        std::vector<Event> events;
+        for (char c : text) events.push_back(classify(c));
+
+        machine_t machine = make_machine();
+        Parser single;
+        for (Event e : events) machine.process(single, e);
+        CHECK(machine.state() == State::key);
+        CHECK(single.key_chars == 5 && single.digits == 4 && single.keys == 4);
+        CHECK(single.values == 4 && single.lines == 3 && single.errors == 2);
+
+        switch_machine hand;
+        Parser expected;
+        for (Event e : events) hand.process(expected, e);
+        CHECK(same(single, expected));
+
+        machine_t batch = make_machine();
+        Parser batched;
+        CHECK(batch.process(batched, events.begin(), events.end()) == State::key);
+        CHECK(same(single, batched));
+
+        std::vector<std::string> log;
+        sy_callback::state_machine<int, int, std::vector<std::string>, 2, 1> toggle(0);
+        toggle.on(0, 0, 1, [](std::vector<std::string>& l) { l.push_back("action"); });
+        toggle.on_exit(0, [](std::vector<std::string>& l) { l.push_back("exit 0"); });
+        toggle.on_entry(1, [](std::vector<std::string>& l) { l.push_back("entry 1"); });
+        toggle.process(log, 0);
+        toggle.process(log, 0);                 // unbound: stays in 1, nothing runs
+        CHECK((log == std::vector<std::string>{ "exit 0", "action", "entry 1" }));
+        CHECK(toggle.state() == 1);
+        std::cout << "transitions: ok\n";
+    }
+
+    // ===== Rebinding at runtime, the source table is untouched =====
+    {
+        machine_t machine = make_machine();
+        CHECK(machine.next(State::key, Event::digit) == State::skip);
+        machine.on(State::key, Event::digit, State::key, &key_char);    // digits allowed in keys
+        Parser p;
+        Event events[] = { Event::letter, Event::digit, Event::equals, Event::digit, Event::newline };
+        machine.process(p, events, events + 5);
+        CHECK(p.key_chars == 2 && p.errors == 0 && p.values == 1);
+        CHECK(protocol[0][1].next == State::skip);
+        CHECK(protocol[0][0].action && !protocol[0][1].action);
+        std::cout << "rebind: ok\n";
+    }
+
+    // ===== Benchmark: table against switch and std::map =====
+    {
+        std::string text;
+        unsigned seed = 7;
+        for (int i = 0; i < 100000; ++i) {
+            seed = seed * 1103515245u + 12345u;
+            switch ((seed >> 16) % 4) {
+            case 0: text += "price=" + std::to_string(seed % 100000) + "\n"; break;
+            case 1: text += "qty=" + std::to_string(seed % 100) + "\n"; break;
+            case 2: text += "side=b\n"; break;
+            default: text += "\n"; break;
+            }
+        }
+        std::vector<Event> events;
+        events.reserve(text.size());
+        for (char c : text) events.push_back(classify(c));
+        const int rounds = 20;
+
+        Parser by_switch, by_map, by_table, by_batch;
+        switch_machine hand;
+        map_machine mapped;
+        machine_t machine = make_machine();
+        machine_t batch = make_machine();
+
+        double switch_ns = per_event([&]() { for (Event e : events) hand.process(by_switch, e); }, events.size(), rounds);
+        double map_ns = per_event([&]() { for (Event e : events) mapped.process(by_map, e); }, events.size(), rounds);
+        double table_ns = per_event([&]() { for (Event e : events) machine.process(by_table, e); }, events.size(), rounds);
+        double batch_ns = per_event([&]() { batch.process(by_batch, events.begin(), events.end()); }, events.size(), rounds);
+        CHECK(same(by_switch, by_map) && same(by_switch, by_table) && same(by_switch, by_batch));
+        CHECK(by_switch.errors > 0);
+
+        std::cout << events.size() << " events, switch: " << switch_ns << " ns/event, state_machine: " << table_ns
+                  << " ns/event, batch: " << batch_ns << " ns/event, std::map: " << map_ns << " ns/event\n";
+    }
+    return 0;
+}
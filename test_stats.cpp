@@ -0,0 +1,95 @@
+// g++ -std=c++11 -O2 -pthread -DSY_CALLBACK_STATS test_stats.cpp -o test_stats
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include "sy_callback.hpp"
+#include "test_util.hpp"
+
+#ifndef SY_CALLBACK_STATS
+#error "build test_stats.cpp with -DSY_CALLBACK_STATS"
+#endif
+
+using callback_t = sy_callback::callback<int(int)>;
+namespace stats = sy_callback::stats;
+
+static int twice(int x) { return x * 2; }
+
+// 40 bytes of captures: stored on the heap through thunk_any
+struct big_handler {
+    long long a, b, c, d, e;
+    int operator()(int x) const { return static_cast<int>(a + b + c + d + e) + x; }
+};
+
+int main() {
+    // ===== Function pointer: nothing on the heap =====
+    {
+        stats::scope guard(true);
+        callback_t cb = &twice;
+        callback_t copy = cb;
+        callback_t moved = std::move(copy);
+        CHECK(cb(1) + moved(1) == 4);
+        CHECK(guard.delta().allocations == 0);
+        CHECK(guard.delta().deep_copies == 0);
+        CHECK(guard.delta().moves == 1);
+        std::cout << "function pointer: ok\n";
+    }
+
+    // ===== Big functor: one allocation, copies are deep =====
+    {
+        stats::scope guard;
+        {
+            callback_t cb = big_handler{ 1, 2, 3, 4, 5 };
+            callback_t copy = cb;
+            copy = cb;
+            CHECK(cb(0) == 15 && copy(0) == 15);
+        }
+        stats::counters c = guard.delta();
+        CHECK(c.allocations == 3);
+        CHECK(c.deep_copies == 2);
+        CHECK(c.destroys == 3);
+        std::cout << "heap functor: ok\n";
+    }
+
+    // ===== Empty calls =====
+    {
+        stats::scope guard;
+        callback_t cb;
+        bool thrown = false;
+        try { cb(0); }
+        catch (const std::bad_function_call&) { thrown = true; }
+        CHECK(thrown && guard.delta().empty_calls == 1);
+        std::cout << "empty calls: ok\n";
+    }
+
+    // ===== Copy assignment releases the previous target =====
+    {
+        stats::scope guard;
+        {
+            callback_t cb = big_handler{ 1, 0, 0, 0, 0 };
+            callback_t other = big_handler{ 2, 0, 0, 0, 0 };
+            cb = other;                 // old target of cb destroyed
+            cb = callback_t();          // empty source empties cb
+            CHECK(!cb);
+        }
+        stats::counters c = guard.delta();
+        CHECK(c.allocations == 3 && c.destroys == 3);
+        std::cout << "copy assignment: ok\n";
+    }
+
+    // ===== Counters are per thread, global() sums them =====
+    {
+        stats::counters before = stats::global();
+        stats::counters mine = stats::local();
+        std::thread worker([]() {
+            callback_t cb = big_handler{ 0, 0, 0, 0, 0 };
+            (void)cb;
+        });
+        worker.join();
+        CHECK(stats::local().allocations == mine.allocations);
+        CHECK(stats::global().allocations == before.allocations + 1);
+        std::cout << "thread local counters: ok\n";
+    }
+
+    stats::dump(stdout);
+    return 0;
+}
@@ -0,0 +1,192 @@
+// g++ -std=c++11 -O2 test_subscriber_set.cpp -o test_subscriber_set
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "sy_signal.hpp"
+#include "sy_subscriber_set.hpp"
+#include "test_util.hpp"
+
+using slot_t = sy_callback::callback<void(int)>;
+
+struct Subscriber {
+    long long received = 0;
+    void on_value(int x) { received += x; }
+    void on_double(int x) { received += 2 * x; }
+};
+
+static slot_t value_slot(Subscriber& s) { return slot_t::make<Subscriber, &Subscriber::on_value>(&s); }
+static slot_t double_slot(Subscriber& s) { return slot_t::make<Subscriber, &Subscriber::on_double>(&s); }
+
+static int total = 0;
+static void add(int x) { total += x; }
+static void subtract(int x) { total -= x; }
+
+// compared by key only: the name does not take part
+struct Keyed {
+    int key;
+    std::string name;
+    bool operator==(const Keyed& other) const { return key == other.key; }
+    void operator()(int x) const { total += key * x; }
+};
+
+namespace std {
+    template<> struct hash<Keyed> {
+        std::size_t operator()(const Keyed& k) const { return std::hash<int>()(k.key); }
+    };
+}
+
+// trivially copyable but padded: the padding bytes are not part of the value, compared by identity
+struct Padded {
+    char tag;
+    long long weight;
+    void operator()(int x) const { total += static_cast<int>(weight) * x + tag; }
+};
+
+template<typename F>
+static double elapsed_ms(F run) {
+    auto start = std::chrono::high_resolution_clock::now();
+    run();
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    // ===== Equality and hashing =====
+    {
+        Subscriber a, b;
+        CHECK(slot_t(&add) == slot_t(&add) && slot_t(&add) != slot_t(&subtract));
+        CHECK(slot_t() == slot_t() && slot_t() != slot_t(&add));
+        slot_t member = value_slot(a);
+        CHECK(member == value_slot(a));
+        CHECK(member != double_slot(a));
+        CHECK(member != value_slot(b));
+        CHECK(member.hash() == value_slot(a).hash());
+        slot_t runtime = slot_t::make(&a, &Subscriber::on_value);
+        CHECK(runtime == slot_t::make(&a, &Subscriber::on_value) && runtime != slot_t::make(&a, &Subscriber::on_double));
+        CHECK(runtime.hash() == slot_t::make(&a, &Subscriber::on_value).hash());
+
+        // trivially copyable captures compare by value, copies of any functor equal each other
+        Subscriber* self = &a;
+        slot_t lambda = [self](int x) { self->on_value(x); };
+        slot_t copy = lambda;
+        CHECK(lambda == copy && lambda.hash() == copy.hash());
+
+        // operator== decides, std::hash<Keyed> spreads the keys
+        slot_t first = Keyed{ 3, "first" }, second = Keyed{ 3, "second" }, other = Keyed{ 4, "first" };
+        CHECK(first == second && first.hash() == second.hash() && first != other);
+        CHECK(first.hash() != other.hash() && first.comparable());
+
+        // neither comparable nor made of value bytes: only the very same callback
+        std::string text = "x";
+        slot_t owning = [text](int) {};
+        slot_t owning_copy = owning;
+        CHECK(owning == owning && owning != owning_copy);
+        CHECK(!owning.comparable() && lambda.comparable() && member.comparable() && slot_t().comparable());
+        slot_t padded = Padded{ 'a', 1 };
+        slot_t padded_copy = padded;
+        CHECK(padded != padded_copy && !padded.comparable());
+
+        std::unordered_set<slot_t> set = { &add, &add, member, lambda, copy };
+        CHECK(set.size() == 3 && set.count(value_slot(a)) == 1);
+        std::cout << "equality: ok\n";
+    }
+
+    // ===== Connect, duplicates and disconnect =====
+    {
+        std::vector<Subscriber> subscribers(100);
+        sy_callback::subscriber_set<void(int)> set;
+        CHECK(!set.connect(slot_t()) && set.empty());
+        std::string text = "x";
+        CHECK(!set.connect([text](int) {}) && !set.connect(Padded{ 'a', 1 }) && set.empty());  // could never be disconnected
+        for (Subscriber& s : subscribers) CHECK(set.connect(value_slot(s)));
+        CHECK(!set.connect(value_slot(subscribers[42])));
+        CHECK(set.connect(double_slot(subscribers[42])));
+        CHECK(set.size() == 101);
+
+        set.emit(1);
+        for (std::size_t i = 0; i < subscribers.size(); ++i) CHECK(subscribers[i].received == (i == 42 ? 3 : 1));
+
+        CHECK(set.disconnect(value_slot(subscribers[0])));
+        CHECK(!set.disconnect(value_slot(subscribers[0])));
+        CHECK(!set.contains(value_slot(subscribers[0])));
+        CHECK(set.contains(value_slot(subscribers[99])));
+        set(1);
+        CHECK(subscribers[0].received == 1 && subscribers[99].received == 2);
+
+        // random connects and disconnects against std::unordered_set
+        std::unordered_set<slot_t> reference(set.begin(), set.end());
+        unsigned seed = 11;
+        for (int step = 0; step < 20000; ++step) {
+            seed = seed * 1103515245u + 12345u;
+            Subscriber* s = &subscribers[(seed >> 16) % subscribers.size()];
+            slot_t slot = (seed >> 8) & 1 ? value_slot(*s) : double_slot(*s);
+            bool expected = (seed >> 4) & 1 ? reference.insert(slot).second : reference.erase(slot) == 1;
+            CHECK(((seed >> 4) & 1 ? set.connect(slot) : set.disconnect(slot)) == expected);
+            CHECK(set.size() == reference.size());
+        }
+        for (const slot_t& slot : reference) CHECK(set.contains(slot));
+        set.clear();
+        CHECK(set.empty() && !set.contains(*reference.begin()) && set.connect(*reference.begin()));
+        std::cout << "subscribers: ok\n";
+    }
+
+    // ===== A cancelled slot released through its handle still disconnects =====
+    {
+        Subscriber a, b;
+        Subscriber* pa = &a;
+        Subscriber* pb = &b;
+        sy_callback::cancellation_source source;
+        slot_t handle = slot_t::make_cancellable(source.token(), [pa](int x) { pa->on_value(x); });
+        slot_t other = slot_t::make_cancellable(source.token(), [pb](int x) { pb->on_value(x); });
+        sy_callback::subscriber_set<void(int)> set;
+        CHECK(set.connect(handle) && set.connect(other));
+
+        source.cancel();
+        CHECK(handle.release_expired() && other.release_expired());
+        CHECK(!handle && handle != other && handle.hash() != other.hash());     // each keeps its own identity
+        CHECK(set.contains(handle) && set.disconnect(handle) && !set.contains(handle));
+        CHECK(set.size() == 1 && set.contains(other) && set.disconnect(other) && set.empty());
+        std::cout << "released: ok\n";
+    }
+
+    // ===== Benchmark: disconnecting in random order =====
+    {
+        const std::size_t N = 10000;
+        std::vector<Subscriber> subscribers(N);
+        std::vector<std::size_t> order(N);
+        for (std::size_t i = 0; i < N; ++i) order[i] = i;
+        unsigned seed = 5;
+        for (std::size_t i = N - 1; i > 0; --i) {
+            seed = seed * 1103515245u + 12345u;
+            std::swap(order[i], order[(seed >> 8) % (i + 1)]);
+        }
+
+        // by connection id: the signal scans for the id
+        sy_callback::signal<void(int)> by_id;
+        std::vector<sy_callback::signal<void(int)>::connection_t> ids(N);
+        for (std::size_t i = 0; i < N; ++i) ids[i] = by_id.connect(value_slot(subscribers[i]));
+        double signal_ms = elapsed_ms([&]() { for (std::size_t i : order) by_id.disconnect(ids[i]); });
+        CHECK(by_id.empty());
+
+        // by value: a scan comparing callbacks
+        std::vector<slot_t> scanned;
+        for (std::size_t i = 0; i < N; ++i) scanned.push_back(value_slot(subscribers[i]));
+        double vector_ms = elapsed_ms([&]() {
+            for (std::size_t i : order) scanned.erase(std::find(scanned.begin(), scanned.end(), value_slot(subscribers[i])));
+        });
+        CHECK(scanned.empty());
+
+        sy_callback::subscriber_set<void(int)> set;
+        for (std::size_t i = 0; i < N; ++i) set.connect(value_slot(subscribers[i]));
+        double set_ms = elapsed_ms([&]() { for (std::size_t i : order) set.disconnect(value_slot(subscribers[i])); });
+        CHECK(set.empty());
+
+        std::cout << N << " subscribers, signal: " << signal_ms << " ms, vector scan: " << vector_ms
+                  << " ms, subscriber_set: " << set_ms << " ms\n";
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+// g++ -std=c++11 -O2 test_thunk_names.cpp -o test_thunk_names
+#define SY_CALLBACK_THUNK_NAMES
+#include <iostream>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+#include "sy_callback.hpp"
+#include "test_util.hpp"
+
+using callback_t = sy_callback::callback<int(int)>;
+
+struct Widget {
+    int base;
+    int draw(int x) { return base + x; }
+    int measure(int x) const { return base * x; }
+};
+
+struct Tracked : sy_callback::trackable {
+    int poll(int x) { return x; }
+};
+
+struct Adder {
+    int step;
+    int operator()(int x) const { return x + step; }
+};
+
+struct Printer {
+    int operator()(int x) const { return x; }
+    int operator()(double x) const { return static_cast<int>(x); }
+};
+
+static int twice(int x) { return x * 2; }
+
+// name -> number of invoke functions registered under it
+static std::map<std::string, int> names() {
+    std::map<std::string, int> result;
+    sy_callback::for_each_thunk_name([&result](const sy_callback::thunk_name& entry) { ++result[entry.name]; });
+    return result;
+}
+
+int main() {
+    // ===== Names of every kind of target =====
+    {
+        Widget widget = { 1 };
+        Tracked tracked;
+        callback_t member = callback_t::make<Widget, &Widget::draw>(&widget);
+        callback_t constant = callback_t::make<Widget, &Widget::measure>(&widget);
+        callback_t runtime = callback_t::make(&widget, &Widget::draw);
+        callback_t owned = callback_t::make<Widget, &Widget::draw>(Widget{ 2 });
+        callback_t watched = callback_t::make_tracked<Tracked, &Tracked::poll>(&tracked);
+        callback_t functor = Adder{ 3 };
+        callback_t pointer = &twice;
+        sy_callback::multi_callback<int(int), int(double)> multi = Printer();
+        CHECK(member(1) == 2 && constant(2) == 2 && runtime(1) == 2 && owned(1) == 3);
+        CHECK(watched(4) == 4 && functor(1) == 4 && pointer(2) == 4 && multi(1) == 1 && multi(2.5) == 2);
+
+        std::map<std::string, int> found = names();
+        CHECK(found["sy_callback Widget::draw"] == 2);         // the pointer binding and the owned object
+        CHECK(found["sy_callback Widget::measure"] == 1);
+        CHECK(found["sy_callback Tracked::poll"] == 1);
+        CHECK(found["sy_callback Widget::* (runtime member)"] == 1);
+        CHECK(found["sy_callback Adder"] == 1);
+        CHECK(found["sy_callback function pointer"] == 1);
+        CHECK(found["sy_callback Printer"] == 2);               // one invoke function per signature
+        std::cout << "names: ok\n";
+    }
+
+    // ===== Registered once, found by address =====
+    {
+        std::size_t count = 0;
+        sy_callback::for_each_thunk_name([&count](const sy_callback::thunk_name&) { ++count; });
+        Widget widget = { 5 };
+        for (int i = 0; i < 100; ++i) {
+            callback_t again = callback_t::make<Widget, &Widget::draw>(&widget);
+            again(i);
+        }
+        // the visitor runs under the registry lock: look the names up afterwards
+        std::vector<sy_callback::thunk_name> entries;
+        sy_callback::for_each_thunk_name([&entries](const sy_callback::thunk_name& entry) { entries.push_back(entry); });
+        CHECK(entries.size() == count);
+        for (const sy_callback::thunk_name& entry : entries)
+            CHECK(sy_callback::find_thunk_name(reinterpret_cast<const void*>(entry.address)) == entry.name);
+        CHECK(sy_callback::find_thunk_name(&widget).empty());
+
+        std::FILE* file = std::tmpfile();
+        CHECK(file && sy_callback::write_thunk_names(file));
+        std::rewind(file);
+        std::size_t lines = 0;
+        for (int c = std::fgetc(file); c != EOF; c = std::fgetc(file)) lines += c == '\n';
+        std::fclose(file);
+        CHECK(lines == count);
+        std::cout << "registry: ok\n";
+    }
+
+    // ===== GCC and Clang signatures =====
+    {
+        CHECK(sy_callback::thunk_target_name(
+            "static constexpr ... thunk_member() [with CLASS = A; MEMBER_T = void (A::*)(int); MEMBER_T FUNC = &A::f; "
+            "RETURN = void; ARGS = {int}; long unsigned int WORDS = 1]") == "sy_callback A::f");
+        CHECK(sy_callback::thunk_target_name(
+            "static func_thunk_t thunk_member() [RETURN = void, ARGS = <int>, WORDS = 1, CLASS = A, "
+            "MEMBER_T = void (A::*)(int), FUNC = &A::f]") == "sy_callback A::f");
+        CHECK(sy_callback::thunk_target_name(
+            "static func_thunk_t thunk_any() [with ANY_T = std::pair<int, int>; RETURN = int]") == "sy_callback std::pair<int, int>");
+        CHECK(sy_callback::thunk_target_name(
+            "static func_thunk_t thunk_member_runtime() [with CLASS = B; MEMBER_T = int (B::*)() const]") ==
+            "sy_callback B::* (runtime member)");
+        CHECK(sy_callback::thunk_target_name("static func_thunk_t thunk_pointer_not_noexcept() [with RETURN = int]") ==
+            "sy_callback function pointer");
+        CHECK(sy_callback::thunk_target_name("no template arguments") == "no template arguments");
+        std::cout << "parsing: ok\n";
+    }
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include "sy_callback.hpp"
+#include "test_util.hpp"
+
+using callback_t = sy_callback::callback<int(int)>;
+
+struct Widget : sy_callback::trackable {
+    int base;
+    explicit Widget(int b) : base(b) {}
+    int add(int x) { return base + x; }
+    int peek(int x) const { return base * x; }
+};
+
+struct Plain {
+    int base;
+    int add(int x) { return base + x; }
+};
+
+int main() {
+    // ===== Liveness =====
+    {
+        callback_t cb, copy;
+        {
+            Widget w(10);
+            cb = callback_t::make_tracked<Widget, &Widget::add>(&w);
+            copy = cb;
+            CHECK(cb.isCallable() && copy);
+            CHECK(cb(1) == 11 && copy(2) == 12);
+
+            const Widget& cw = w;
+            callback_t peek = callback_t::make_tracked<const Widget, &Widget::peek>(&cw);
+            CHECK(peek(3) == 30);
+        }
+        CHECK(!cb.isCallable() && !copy);
+        bool thrown = false;
+        try { cb(1); }
+        catch (const std::bad_function_call&) { thrown = true; }
+        CHECK(thrown);
+        CHECK(cb.release_expired() && !cb.release_expired() && cb == callback_t());   // lets go of the block, empty now
+        CHECK(!copy && copy != callback_t());
+        std::cout << "liveness: ok\n";
+    }
+
+    // ===== A copied object is tracked on its own =====
+    {
+        Widget* original = new Widget(1);
+        Widget copy_of(*original);
+        callback_t a = callback_t::make_tracked<Widget, &Widget::add>(original);
+        callback_t b = callback_t::make_tracked<Widget, &Widget::add>(&copy_of);
+        delete original;
+        CHECK(!a && b && b(1) == 2);
+        std::cout << "copies: ok\n";
+    }
+
+    // ===== The control block goes when the last holder does =====
+    {
+        Widget w(0);
+        long long before = allocations;
+        {
+            callback_t a = callback_t::make_tracked<Widget, &Widget::add>(&w);
+            callback_t b = callback_t::make_tracked<Widget, &Widget::add>(&w);
+            callback_t c = a;
+            (void)b; (void)c;
+        }
+        CHECK(allocations - before == 1);       // one control block for the object, shared by all three
+        std::cout << "control block: ok\n";
+    }
+
+    // ===== Cost against a weak_ptr lambda =====
+    {
+        const int N = 20000000;
+        Widget tracked(1);
+        callback_t fast = callback_t::make_tracked<Widget, &Widget::add>(&tracked);
+
+        std::shared_ptr<Plain> shared = std::make_shared<Plain>(Plain{ 1 });
+        std::weak_ptr<Plain> weak = shared;
+        long long before = allocations;
+        callback_t slow = [weak](int x) { 
+            std::shared_ptr<Plain> p = weak.lock();
+            return p ? p->add(x) : 0;
+        };
+        long long lambda_allocations = allocations - before;
+
+        Plain raw{ 1 };
+        callback_t untracked = callback_t::make<Plain, &Plain::add>(&raw);
+
+        auto bench = [&](const char* name, const callback_t& cb) {
+            long long sum = 0;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < N; ++i) sum += cb(i);
+            auto end = std::chrono::high_resolution_clock::now();
+            std::cout << name << ": " << std::chrono::duration<double, std::nano>(end - start).count() / N
+                      << " ns/call (" << sum % 7 << ")\n";
+        };
+        bench("raw member binding    ", untracked);
+        bench("tracked member binding", fast);
+        bench("weak_ptr lambda       ", slow);
+        std::cout << "weak_ptr lambda allocations: " << lambda_allocations << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,28 @@
+// shared by the test_*.cpp files, each of which is its own program:
+// CHECK fails main() with the expression, allocations counts every global operator new
+#pragma once
+#ifndef SY_TEST_UTIL_HPP
+#define SY_TEST_UTIL_HPP
+
+#include <iostream>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#define CHECK(EXPR) do { if (!(EXPR)) { std::cout << "failed: " #EXPR "\n"; return 1; } } while (0)
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// atomic: the threaded tests allocate from several threads
+static std::atomic<long long> allocations(0);
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+#endif